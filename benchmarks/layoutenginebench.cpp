@@ -0,0 +1,107 @@
+/*
+ * Benchmark of the layout engines and the tiling result buffer.
+ *
+ * Every case lays out the given number of placeholder clients with one
+ * LayoutEngine into a reused TilingResult, i.e. the steps that
+ * FrameLeaf::computeLayout() takes for a single frame. The frame tree
+ * itself (Frame::computeLayout(), split, load) is not covered, because
+ * frames create X windows for their decorations.
+ *
+ * Usage: herbstluftwm-layoutengine-bench [MILLISECONDS_PER_CASE]
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "framedata.h"
+#include "layoutengine.h"
+#include "tilingresult.h"
+
+using std::chrono::duration_cast;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+using std::vector;
+
+//! the mock client layer: no client is pseudotiled
+class BenchClientState : public LayoutClientState {
+public:
+    bool pseudotiled(size_t) const override {
+        return false;
+    }
+};
+
+static const LayoutAlgorithm g_algorithms[] = {
+    LayoutAlgorithm::vertical,
+    LayoutAlgorithm::horizontal,
+    LayoutAlgorithm::max,
+    LayoutAlgorithm::grid,
+    LayoutAlgorithm::master,
+};
+
+static const char* g_algorithm_names[] = {
+    "vertical",
+    "horizontal",
+    "max",
+    "grid",
+    "master",
+};
+
+static const size_t g_max_clients = 500;
+
+//! distinct client pointers that are never dereferenced
+static Client* placeholderClient(size_t index) {
+    static char storage[g_max_clients];
+    return reinterpret_cast<Client*>(storage + index);
+}
+
+//! apply the engine repeatedly for the given time and return the average
+//! nanoseconds per layout
+static double measure(const LayoutEngine& engine,
+                      const vector<Client*>& clients, long durationMs)
+{
+    Rectangle rect = { 0, 0, 3840, 2160 };
+    BenchClientState clientState;
+    LayoutOptions options;
+    int selection = static_cast<int>(clients.size() / 2);
+    // reused like the layout buffer of a monitor
+    TilingResult res;
+    long iterations = 0;
+    auto start = steady_clock::now();
+    auto deadline = start + milliseconds(durationMs);
+    auto now = start;
+    do {
+        for (int i = 0; i < 100; i++) {
+            res.clear();
+            engine.apply(clients, clientState, selection, rect, options, res);
+        }
+        iterations += 100;
+        now = steady_clock::now();
+    } while (now < deadline);
+    return duration_cast<nanoseconds>(now - start).count()
+            / static_cast<double>(iterations);
+}
+
+int main(int argc, char** argv) {
+    long durationMs = 100;
+    if (argc > 1) {
+        durationMs = atol(argv[1]);
+    }
+    const size_t clientCounts[] = { 1, 10, 100, g_max_clients };
+    printf("%-10s %7s %12s %12s\n",
+           "algorithm", "clients", "ns/layout", "ns/client");
+    for (size_t a = 0; a < sizeof(g_algorithms) / sizeof(g_algorithms[0]); a++) {
+        const LayoutEngine& engine = LayoutEngine::forAlgorithm(g_algorithms[a]);
+        for (auto clientCount : clientCounts) {
+            vector<Client*> clients;
+            for (size_t i = 0; i < clientCount; i++) {
+                clients.push_back(placeholderClient(i));
+            }
+            double ns = measure(engine, clients, durationMs);
+            printf("%-10s %7zu %12.0f %12.1f\n",
+                   g_algorithm_names[a], clientCount, ns, ns / clientCount);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,389 @@
+#!/usr/bin/env python3
+"""
+Load generator for herbstluftwm.
+
+Starts herbstluftwm on a fresh Xvfb server (or an existing display), opens
+many windows with varied WM_CLASS, titles and size hints, and then, for the
+given duration, changes window titles, presses bound keys and calls
+herbstclient commands at the requested rates. At the end, it prints the
+response latency of herbstluftwm, its CPU time and its event statistics.
+
+Run it from the build directory, like the tests:
+
+    ../benchmarks/loadgen.py --windows 300 --duration 30
+
+The windows, title changes, commands and key presses each draw from their
+own random generator seeded by --seed. So two runs with the same arguments
+send the same sequence of requests of each kind; only the interleaving of
+the different kinds depends on timing.
+"""
+from Xlib import X, Xutil, XK
+from Xlib.ext import xtest
+import Xlib.display
+import argparse
+import json
+import os
+import random
+import select
+import subprocess
+import sys
+import tempfile
+import time
+
+# the commands sent via herbstclient during the load phase
+COMMANDS = [
+    'cycle',
+    'cycle -1',
+    'cycle_all',
+    'cycle_layout',
+    'cycle_frame',
+    'use_index +1',
+    'split auto',
+    'remove',
+    'get_attr clients.focus.title',
+    'dump',
+]
+
+# the keys bound during the load phase, each emits a hook when it is done
+KEYBINDS = {
+    'F1': 'cycle',
+    'F2': 'cycle_frame',
+    'F3': 'use_index -1',
+    'F4': 'cycle_layout',
+}
+
+# the events whose statistics are printed at the end
+EVENTS = ['KeyPress', 'MapRequest', 'ConfigureRequest', 'PropertyNotify',
+          'ClientMessage', 'UnmapNotify', 'DestroyNotify']
+
+KEY_HOOK = 'loadgen_key'
+
+
+class Herbstclient:
+    def __init__(self, path, env):
+        self.path = path
+        self.env = env
+
+    def call(self, *args, check=True):
+        proc = subprocess.run([self.path, '-n'] + list(args), env=self.env,
+                              stdout=subprocess.PIPE, stderr=subprocess.PIPE,
+                              universal_newlines=True, timeout=10)
+        if check and proc.returncode != 0:
+            raise RuntimeError('herbstclient {} failed: {}'.format(
+                ' '.join(args), proc.stderr.strip()))
+        return proc
+
+    def try_get_attr(self, path):
+        proc = self.call('get_attr', path, check=False)
+        return proc.stdout if proc.returncode == 0 else None
+
+
+class Latencies:
+    def __init__(self):
+        self.samples = []
+
+    def add(self, seconds):
+        self.samples.append(seconds * 1000)
+
+    def summary(self):
+        if not self.samples:
+            return {'count': 0}
+        s = sorted(self.samples)
+        return {
+            'count': len(s),
+            'mean_ms': sum(s) / len(s),
+            'p50_ms': s[len(s) // 2],
+            'p95_ms': s[min(len(s) - 1, len(s) * 95 // 100)],
+            'max_ms': s[-1],
+        }
+
+
+def start_xvfb(geometry):
+    """start an Xvfb server and return the process and its display name"""
+    pipe_read, pipe_write = os.pipe()
+    proc = subprocess.Popen(['Xvfb', '-nolisten', 'tcp', '-noreset',
+                             '-screen', '0', geometry + 'x24',
+                             '-displayfd', str(pipe_write)],
+                            pass_fds=[pipe_write])
+    display_bytes = bytes()
+    while True:
+        chunk = os.read(pipe_read, 1)
+        display_bytes += chunk
+        if len(chunk) < 1 or chunk == b'\n':
+            break
+    os.close(pipe_read)
+    os.close(pipe_write)
+    return proc, ':' + display_bytes.decode().rstrip()
+
+
+def cpu_seconds(pid):
+    """return the user and system CPU time of the given process"""
+    with open('/proc/{}/stat'.format(pid)) as stat:
+        # the fields after the command name, which may contain spaces
+        fields = stat.read().rsplit(')', 1)[1].split()
+    ticks = os.sysconf('SC_CLK_TCK')
+    # utime and stime are the 14th and 15th field of the full line
+    return int(fields[11]) / ticks, int(fields[12]) / ticks
+
+
+def client_count(display):
+    atom = display.intern_atom('_NET_CLIENT_LIST')
+    prop = display.screen().root.get_full_property(atom, X.AnyPropertyType)
+    return len(prop.value) if prop is not None else 0
+
+
+def create_window(display, rng, index, tags):
+    screen = display.screen()
+    width = rng.randint(100, 800)
+    height = rng.randint(80, 600)
+    w = screen.root.create_window(
+        rng.randint(0, 400), rng.randint(0, 300), width, height, 0,
+        screen.root_depth, X.InputOutput, X.CopyFromParent,
+        background_pixel=screen.white_pixel)
+    w.set_wm_class('loadgen-{}'.format(index), 'LoadGen{}'.format(index % tags))
+    w.set_wm_name('loadgen window {}'.format(index))
+    kind = index % 4
+    if kind == 1:
+        # like a terminal: a minimum size and resize increments
+        w.set_wm_normal_hints(flags=Xutil.PMinSize | Xutil.PResizeInc,
+                              min_width=40, min_height=30,
+                              width_inc=7, height_inc=13)
+    elif kind == 2:
+        w.set_wm_normal_hints(flags=Xutil.PMinSize | Xutil.PMaxSize,
+                              min_width=width // 2, min_height=height // 2,
+                              max_width=width, max_height=height)
+    elif kind == 3:
+        w.set_wm_normal_hints(flags=Xutil.PAspect,
+                              min_aspect={'num': 4, 'denum': 3},
+                              max_aspect={'num': 16, 'denum': 9})
+    w.map()
+    return w
+
+
+def wait_until(predicate, timeout, what):
+    deadline = time.monotonic() + timeout
+    while not predicate():
+        if time.monotonic() > deadline:
+            sys.exit('Timeout while waiting for ' + what)
+        time.sleep(0.05)
+
+
+def press_key(display, keycode, key_hook, latencies):
+    """press and release the key and wait for the hook of its keybind"""
+    start = time.monotonic()
+    xtest.fake_input(display, X.KeyPress, keycode)
+    xtest.fake_input(display, X.KeyRelease, keycode)
+    display.flush()
+    while True:
+        ready, _, _ = select.select([key_hook.stdout], [], [], 5)
+        if not ready:
+            sys.exit('herbstluftwm did not react to a key press within 5 seconds')
+        # skip the hooks emitted by wait_for_hook_listener()
+        if key_hook.stdout.readline().rstrip('\n') == KEY_HOOK:
+            break
+    latencies.add(time.monotonic() - start)
+
+
+def wait_for_hook_listener(hc, key_hook):
+    """emit hooks until the hook listener receives one"""
+    deadline = time.monotonic() + 10
+    while time.monotonic() < deadline:
+        hc.call('emit_hook', KEY_HOOK, 'ready')
+        ready, _, _ = select.select([key_hook.stdout], [], [], 0.1)
+        if ready:
+            key_hook.stdout.readline()
+            return
+    sys.exit('Timeout while waiting for herbstclient --idle')
+
+
+def run(args):
+    xvfb = None
+    display_name = args.display
+    if display_name is None:
+        xvfb, display_name = start_xvfb(args.screen)
+    env = {'DISPLAY': display_name, 'PATH': os.environ.get('PATH', '')}
+    config_home = tempfile.TemporaryDirectory()
+    env['XDG_CONFIG_HOME'] = config_home.name
+    os.makedirs(os.path.join(config_home.name, 'herbstluftwm'))
+    autostart = os.path.join(config_home.name, 'herbstluftwm', 'autostart')
+    with open(autostart, 'w') as f:
+        f.write('#!/bin/sh\nexit 0\n')
+    os.chmod(autostart, 0o755)
+
+    hlwm = subprocess.Popen([args.herbstluftwm, '--no-tag-import'], env=env,
+                            stdout=subprocess.DEVNULL,
+                            stderr=subprocess.DEVNULL)
+    hc = Herbstclient(args.herbstclient, env)
+    key_hook = None
+    try:
+        wait_until(lambda: hc.call('true', check=False).returncode == 0,
+                   10, 'herbstluftwm to start')
+        for i in range(args.tags):
+            hc.call('add', str(i))
+            hc.call('rule', 'class=LoadGen{}'.format(i), 'tag={}'.format(i))
+        hc.call('use', '0')
+        hc.call('merge_tag', 'default')
+        for key, command in KEYBINDS.items():
+            hc.call('keybind', key, 'chain', ',', *command.split(' '),
+                    ',', 'emit_hook', KEY_HOOK)
+
+        display = Xlib.display.Display(display_name)
+        # one generator per kind of request, such that the requests of one
+        # kind do not depend on how many requests of the other kinds are sent
+        rng = {kind: random.Random('{}-{}'.format(args.seed, kind))
+               for kind in ['window', 'title', 'command', 'key']}
+        start = time.monotonic()
+        windows = [create_window(display, rng['window'], i, args.tags)
+                   for i in range(args.windows)]
+        display.flush()
+        wait_until(lambda: client_count(display) >= args.windows,
+                   60, 'all windows to be managed')
+        map_duration = time.monotonic() - start
+        keycodes = [display.keysym_to_keycode(XK.string_to_keysym(k))
+                    for k in KEYBINDS]
+        key_hook = subprocess.Popen([args.herbstclient, '--idle', KEY_HOOK],
+                                    env=env, stdout=subprocess.PIPE,
+                                    universal_newlines=True, bufsize=1)
+        wait_for_hook_listener(hc, key_hook)
+
+        hc.call('reset_stats')
+        command_latency = Latencies()
+        key_latency = Latencies()
+        title_changes = 0
+        cpu_start = cpu_seconds(hlwm.pid)
+        start = time.monotonic()
+        end = start + args.duration
+        # the next time of each kind of action, None if it is disabled
+        next_title = start if args.title_rate > 0 else None
+        next_command = start if args.command_rate > 0 else None
+        next_key = start if args.key_rate > 0 else None
+        while True:
+            now = time.monotonic()
+            if now >= end:
+                break
+            if next_title is not None and now >= next_title:
+                w = rng['title'].choice(windows)
+                title_changes += 1
+                w.set_wm_name('loadgen title {}'.format(title_changes))
+                display.flush()
+                next_title += 1 / args.title_rate
+            if next_command is not None and now >= next_command:
+                command = rng['command'].choice(COMMANDS)
+                before = time.monotonic()
+                hc.call(*command.split(' '), check=False)
+                command_latency.add(time.monotonic() - before)
+                next_command += 1 / args.command_rate
+            if next_key is not None and now >= next_key:
+                press_key(display, rng['key'].choice(keycodes), key_hook,
+                          key_latency)
+                next_key += 1 / args.key_rate
+            # drop the events sent to our windows, e.g. ConfigureNotify
+            while display.pending_events():
+                display.next_event()
+            upcoming = [t for t in [next_title, next_command, next_key, end]
+                        if t is not None]
+            time.sleep(max(0, min(upcoming) - time.monotonic()))
+        duration = time.monotonic() - start
+        cpu_end = cpu_seconds(hlwm.pid)
+
+        results = {
+            'windows': args.windows,
+            'map_duration_s': map_duration,
+            'duration_s': duration,
+            'title_changes': title_changes,
+            'command_latency': command_latency.summary(),
+            'key_latency': key_latency.summary(),
+            'cpu_user_s': cpu_end[0] - cpu_start[0],
+            'cpu_system_s': cpu_end[1] - cpu_start[1],
+            'events': {},
+        }
+        results['cpu_percent'] = 100 * (results['cpu_user_s']
+                                        + results['cpu_system_s']) / duration
+        for event in EVENTS:
+            calls = hc.try_get_attr('stats.events.{}.calls'.format(event))
+            if calls is None:
+                continue
+            path = 'stats.events.{}.time_total_us'.format(event)
+            results['events'][event] = {
+                'calls': int(calls),
+                'time_total_us': int(hc.try_get_attr(path)),
+            }
+        hc.call('quit')
+        hlwm.wait(10)
+        display.close()
+        return results
+    finally:
+        if key_hook is not None:
+            key_hook.terminate()
+            key_hook.wait(2)
+        if hlwm.poll() is None:
+            hlwm.terminate()
+            hlwm.wait(5)
+        if xvfb is not None:
+            xvfb.terminate()
+            xvfb.wait(5)
+        config_home.cleanup()
+
+
+def print_results(results):
+    print('{} windows mapped in {:.2f} s'.format(
+        results['windows'], results['map_duration_s']))
+    print('{} title changes in {:.2f} s'.format(
+        results['title_changes'], results['duration_s']))
+    print('herbstluftwm CPU: {:.2f} s user, {:.2f} s system ({:.1f} %)'.format(
+        results['cpu_user_s'], results['cpu_system_s'],
+        results['cpu_percent']))
+    print('{:<12} {:>6} {:>9} {:>9} {:>9} {:>9}'.format(
+        'latency', 'count', 'mean_ms', 'p50_ms', 'p95_ms', 'max_ms'))
+    for name in ['command', 'key']:
+        s = results[name + '_latency']
+        if s['count'] == 0:
+            continue
+        print('{:<12} {:>6} {:>9.2f} {:>9.2f} {:>9.2f} {:>9.2f}'.format(
+            name, s['count'], s['mean_ms'], s['p50_ms'], s['p95_ms'],
+            s['max_ms']))
+    print('{:<18} {:>8} {:>14}'.format('event', 'calls', 'time_total_us'))
+    for event, stats in results['events'].items():
+        print('{:<18} {:>8} {:>14}'.format(
+            event, stats['calls'], stats['time_total_us']))
+
+
+def main():
+    bindir = os.path.abspath(os.environ.get('PWD', '.'))
+    parser = argparse.ArgumentParser(description=__doc__.strip().split('\n')[0],
+                                     formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+    parser.add_argument('--herbstluftwm',
+                        default=os.path.join(bindir, 'herbstluftwm'))
+    parser.add_argument('--herbstclient',
+                        default=os.path.join(bindir, 'herbstclient'))
+    parser.add_argument('--display',
+                        help='use this X server instead of starting Xvfb')
+    parser.add_argument('--screen', default='1920x1080',
+                        help='the screen size of the Xvfb server')
+    parser.add_argument('--windows', type=int, default=300)
+    parser.add_argument('--tags', type=int, default=9,
+                        help='the number of tags the windows are spread over')
+    parser.add_argument('--duration', type=float, default=20,
+                        help='the duration of the load phase in seconds')
+    parser.add_argument('--title-rate', type=float, default=200,
+                        help='title changes per second')
+    parser.add_argument('--command-rate', type=float, default=20,
+                        help='herbstclient commands per second')
+    parser.add_argument('--key-rate', type=float, default=5,
+                        help='key presses per second')
+    parser.add_argument('--seed', type=int, default=0)
+    parser.add_argument('--json', metavar='FILE',
+                        help='also write the results to this file')
+    args = parser.parse_args()
+    if args.tags < 1:
+        parser.error('--tags must be at least 1')
+
+    results = run(args)
+    print_results(results)
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump(results, f, indent=4)
+
+
+if __name__ == '__main__':
+    main()
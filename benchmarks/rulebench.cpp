@@ -0,0 +1,141 @@
+/*
+ * Benchmark of the regex conditions of rules.
+ *
+ * Rules and their conditions are evaluated against a Client, which needs an
+ * X connection, so this benchmark does not run Rule or Condition itself.
+ * Instead, it runs the two ways in which Condition::matches() checks a
+ * regex condition: a regex that only consists of literal alternatives
+ * (e.g. class~'Gimp|Inkscape', see RegexStr::literalAlternatives()) is
+ * checked by a lookup in a set, every other regex by std::regex_match().
+ * For comparison, it also runs std::regex_match() for the literal regexes,
+ * as rules did before.
+ *
+ * Each case matches the window classes of a session against a rule set in
+ * which the given percentage of the regexes are literal alternatives.
+ *
+ * Usage: herbstluftwm-rule-bench [MILLISECONDS_PER_CASE]
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <regex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "regexstr.h"
+
+using std::chrono::duration_cast;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+using std::regex;
+using std::set;
+using std::string;
+using std::to_string;
+using std::vector;
+
+//! a regex condition as prepared by Rule::addCondition()
+class BenchCondition {
+public:
+    BenchCondition(const string& source)
+        : regex_(source, regex::extended)
+    {
+        literal_ = RegexStr::literalAlternatives(source, literals_);
+    }
+
+    //! the check of Condition::matches()
+    bool matches(const string& str) const {
+        if (literal_) {
+            return literals_.count(str) > 0;
+        }
+        return std::regex_match(str, regex_);
+    }
+
+    //! the check without the literal lookup
+    bool matchesRegex(const string& str) const {
+        return std::regex_match(str, regex_);
+    }
+
+private:
+    regex regex_;
+    bool literal_ = false;
+    set<string> literals_;
+};
+
+//! the window classes that the rules are matched against
+static const vector<string> g_classes = {
+    "Firefox", "XTerm", "Gimp-2.10", "Inkscape", "mpv", "Thunderbird",
+    "Pavucontrol", "URxvt", "Zathura", "Emacs",
+};
+
+//! a rule set of the given size in which 'literalPercent' percent of the
+//! regexes are literal alternatives
+static vector<BenchCondition> makeRules(size_t count, size_t literalPercent) {
+    vector<BenchCondition> rules;
+    for (size_t i = 0; i < count; i++) {
+        string name = "App" + to_string(i);
+        if (i * 100 < count * literalPercent) {
+            rules.emplace_back(name + "|" + name + "-bin");
+        } else {
+            rules.emplace_back(name + "(-[0-9.]+)?");
+        }
+    }
+    return rules;
+}
+
+//! match all classes against all rules repeatedly for the given time and
+//! return the average nanoseconds per client
+template<typename Matcher>
+static double measure(const vector<BenchCondition>& rules, long durationMs,
+                      Matcher matcher) {
+    long iterations = 0;
+    size_t matchCount = 0;
+    auto start = steady_clock::now();
+    auto deadline = start + milliseconds(durationMs);
+    auto now = start;
+    do {
+        for (const auto& windowClass : g_classes) {
+            for (const auto& rule : rules) {
+                if (matcher(rule, windowClass)) {
+                    matchCount++;
+                }
+            }
+        }
+        iterations += g_classes.size();
+        now = steady_clock::now();
+    } while (now < deadline);
+    if (matchCount > 0) {
+        // none of the classes matches any rule
+        fprintf(stderr, "unexpected match\n");
+    }
+    return duration_cast<nanoseconds>(now - start).count()
+            / static_cast<double>(iterations);
+}
+
+int main(int argc, char** argv) {
+    long durationMs = 100;
+    if (argc > 1) {
+        durationMs = atol(argv[1]);
+    }
+    const size_t ruleCounts[] = { 10, 100, 500 };
+    const size_t literalPercents[] = { 0, 50, 100 };
+    printf("%5s %8s %14s %14s\n",
+           "rules", "literal%", "ns/client", "ns/client(re)");
+    for (auto ruleCount : ruleCounts) {
+        for (auto literalPercent : literalPercents) {
+            auto rules = makeRules(ruleCount, literalPercent);
+            double ns = measure(rules, durationMs,
+                [](const BenchCondition& rule, const string& str) {
+                    return rule.matches(str);
+                });
+            double nsRegex = measure(rules, durationMs,
+                [](const BenchCondition& rule, const string& str) {
+                    return rule.matchesRegex(str);
+                });
+            printf("%5zu %8zu %14.0f %14.0f\n",
+                   ruleCount, literalPercent, ns, nsRegex);
+        }
+    }
+    return 0;
+}
@@ -127,6 +127,9 @@ if args.run_tests:
     # Suppress warnings about known memory leaks:
     os.environ['LSAN_OPTIONS'] = f"suppressions={repo}/ci/lsan-suppressions.txt"
 
+    # The unit tests of the core library do not need an X server
+    sp.check_call(['ctest', '--output-on-failure'], cwd=build_dir)
+
     # First, run only the tests that are NOT marked to be excluded from code
     # coverage collection.
     tox('-e py38 -- -n auto --cache-clear -v -x -m "not exclude_from_coverage"', build_dir)
@@ -5,27 +5,45 @@
 #include "utils.h"
 
 using std::make_shared;
+using std::shared_ptr;
 using std::string;
 using std::stringstream;
 
 ArgList::ArgList(const std::initializer_list<string> &l)
     : container_(make_shared<Container>(l))
-{ reset(); }
+{ setFullRange(); }
 
 ArgList::ArgList(const ArgList::Container &c)
     : container_(make_shared<Container>(c))
-{ reset(); }
+{ setFullRange(); }
 
-ArgList::ArgList(const ArgList &al) : container_(al.container_) { reset(); }
+ArgList::ArgList(const ArgList &al)
+    : first_(al.first_)
+    , end_(al.end_)
+    , container_(al.container_)
+{ reset(); }
 
 ArgList::ArgList(const string &s, char delim) {
     container_ = make_shared<Container>(split(s, delim));
-    reset();
+    setFullRange();
 }
 
 ArgList::ArgList(Container::const_iterator from, Container::const_iterator to)
 {
     container_ = make_shared<Container>(from, to);
+    setFullRange();
+}
+
+ArgList::ArgList(shared_ptr<Container> container,
+                 Container::const_iterator from, Container::const_iterator to)
+    : first_(from)
+    , end_(to)
+    , container_(container)
+{ reset(); }
+
+void ArgList::setFullRange() {
+    first_ = container_->cbegin();
+    end_ = container_->cend();
     reset();
 }
 
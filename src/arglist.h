@@ -19,33 +19,34 @@ public:
     ArgList(const std::initializer_list<std::string> &l);
     ArgList(Container::const_iterator from, Container::const_iterator to);
     ArgList(const ArgList &al);
+    ArgList& operator=(const ArgList &al) = default;
     ArgList(const Container &c);
     // constructor that splits the given string
     ArgList(const std::string &s, char delim = '.');
     virtual ~ArgList() {}
 
     Container::const_iterator begin() const { return begin_; }
-    Container::const_iterator end() const { return container_->cend(); }
+    Container::const_iterator end() const { return end_; }
     const std::string& front() { return *begin_; }
-    const std::string& back() { return container_->back(); }
-    bool empty() const { return begin_ == container_->end(); }
+    const std::string& back() { return *(end_ - 1); }
+    bool empty() const { return begin_ == end_; }
     Container::size_type size() const {
-        return std::distance(begin_, container_->cend());
+        return std::distance(begin_, end_);
     }
 
     std::string join(char delim = '.');
 
     //! reset internal pointer to begin of arguments
     void reset() {
-        begin_ = container_->cbegin();
+        begin_ = first_;
         shiftedTooFar_ = false;
     }
     //! shift the internal pointer by amount
     void shift(Container::difference_type amount = 1) {
-        begin_ += std::min(amount, std::distance(begin_, container_->cend()));
+        begin_ += std::min(amount, std::distance(begin_, end_));
     }
     Container toVector() const {
-        return Container(begin_, container_->cend());
+        return Container(begin_, end_);
     }
     //! try read a value if possible
     virtual ArgList& operator>>(std::string& val);
@@ -56,15 +57,25 @@ public:
     }
 
 protected:
+    //! the range [from, to) of the given container, without copying it
+    ArgList(std::shared_ptr<Container> container,
+            Container::const_iterator from, Container::const_iterator to);
+    //! set the range to the entire container_
+    void setFullRange();
+
     //! shift state pointing into container_
     Container::const_iterator begin_;
+    //! the range [first_, end_) of container_ that forms the arguments
+    Container::const_iterator first_;
+    Container::const_iterator end_;
     //! indicator that we attempted to shift too far (shift is at end())
     bool shiftedTooFar_ = false;
     /*! Argument vector
      * @note This is a shared pointer to make object copy-able:
      * 1. payload is shared (no redundant copies)
      * 2. begin_ stays valid
-     * 3. The C-style compatibility layer DEPENDS on the shared_ptr!
+     * 3. Sub-ranges (e.g. the commands in a chain) share the container
+     * Therefore, the container must not be modified once it is shared.
      */
     std::shared_ptr<Container> container_;
 };
@@ -1,5 +1,8 @@
 #include "attribute.h"
 
+#include <algorithm>
+
+#include "attribute_.h"
 #include "object.h"
 
 using std::string;
@@ -16,18 +19,29 @@ string Attribute::cycleValue(vector<string>::const_iterator begin,
     if (begin == end) {
         return {};
     }
-    string cur_value = str();
-    for (auto it = begin; it != end; ++it) {
-        if (*it == cur_value) {
-            // if the value is found
-            ++it;
-            if (it != end) {
-                // and if the next is still in range
-                // change the value
-                return change(*it);
-            } else {
-                break;
+    vector<string>::const_iterator it;
+    TypedAttribute<bool>* boolAttr = typed<bool>();
+    if (boolAttr) {
+        // compare booleans by value, such that the current value is
+        // also found if it is spelled e.g. 'on' or '1'.
+        bool cur_value = boolAttr->value();
+        it = std::find_if(begin, end, [cur_value](const string& s) {
+            try {
+                return Converter<bool>::parse(s) == cur_value;
+            } catch (std::invalid_argument&) {
+                return false;
             }
+        });
+    } else {
+        it = std::find(begin, end, str());
+    }
+    if (it != end) {
+        // if the value is found
+        ++it;
+        if (it != end) {
+            // and if the next is still in range
+            // change the value
+            return change(*it);
         }
     }
     // if the value is not found or was the last element
@@ -9,6 +9,7 @@
 class Object;
 class Signal;
 class Completion;
+template<typename T> class TypedAttribute;
 
 /* Attributes.
  * Attributes are members of Objects that expose internal state variables to the
@@ -63,6 +64,9 @@ public:
 
     virtual std::string str() { return {}; }
     virtual std::string change(const std::string &payload) = 0;
+    //! access to the value without string conversion if the attribute
+    //! is of type T, and nullptr otherwise. (defined in attribute_.h)
+    template<typename T> TypedAttribute<T>* typed();
     //! suggestions for a new value of the attribute
     virtual void complete(Completion& complete) = 0;
 
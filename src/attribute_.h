@@ -11,8 +11,24 @@
 
 class Completion;
 
+/** The common interface of Attribute_<T> and DynAttribute_<T> for reading the
+ * value of type T directly, i.e. without formatting it via Converter<T>::str().
+ * Given a generic Attribute*, it is obtained via Attribute::typed<T>().
+ */
 template<typename T>
-class Attribute_ : public Attribute {
+class TypedAttribute {
+public:
+    virtual ~TypedAttribute() = default;
+    virtual T value() = 0;
+};
+
+template<typename T>
+inline TypedAttribute<T>* Attribute::typed() {
+    return dynamic_cast<TypedAttribute<T>*>(this);
+}
+
+template<typename T>
+class Attribute_ : public Attribute, public TypedAttribute<T> {
 public:
     // function that validates a new attribute value against the current state
     // if the attribute value is valid, returns the empty string.
@@ -110,6 +126,8 @@ public:
     // wrap Converter::str() for convenience
     std::string str() override { return Converter<T>::str(payload_); }
 
+    T value() override { return payload_; }
+
     void complete(Completion& complete) override {
         Converter<T>::complete(complete, &payload_);
     }
@@ -206,7 +224,7 @@ template<>
 inline Type Attribute_<Color>::staticType() { return Type::ATTRIBUTE_COLOR; }
 
 template<typename T>
-class DynAttribute_ : public Attribute {
+class DynAttribute_ : public Attribute, public TypedAttribute<T> {
 public:
     // each time a dynamic attribute is read, the getter_ is called in order to
     // get the actual value
@@ -299,6 +317,8 @@ public:
         return Converter<T>::str(getter_());
     }
 
+    T value() override { return getter_(); }
+
     std::string change(const std::string &payload_str) override {
         if (!writeable()) {
             return "attribute is read-only";
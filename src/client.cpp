@@ -1,13 +1,16 @@
 #include "client.h"
 
+#include <X11/Xatom.h>
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
 #include <cstdlib>
 #include <cstring>
 #include <sstream>
+#include <unistd.h>
 
 #include "clientmanager.h"
 #include "decoration.h"
+#include "displaybackend.h"
 #include "ewmh.h"
 #include "globals.h"
 #include "hook.h"
@@ -23,6 +26,7 @@
 #include "utils.h"
 #include "xconnection.h"
 
+using std::pair;
 using std::string;
 using std::stringstream;
 
@@ -33,7 +37,7 @@ static Client* lastfocus = nullptr;
 
 Client::Client(Window window, bool visible_already, ClientManager& cm)
     : window_(window)
-    , dec(make_unique<Decoration>(this, *cm.settings))
+    , dec(make_unique<Decoration>(this, *cm.settings, *cm.backend))
     , visible_(visible_already)
     , urgent_(this, "urgent", false)
     , floating_(this,  "floating", false)
@@ -56,6 +60,7 @@ Client::Client(Window window, bool visible_already, ClientManager& cm)
     , theme(*cm.theme)
     , settings(*cm.settings)
     , ewmh(*cm.ewmh)
+    , backend(*cm.backend)
 {
     stringstream tmp;
     window_id_str = WindowID(window).str();
@@ -93,8 +98,8 @@ void Client::init_from_X() {
     float_size_ = root->monitors->interpretGlobalGeometry(globalGeometry);
     last_size_ = float_size_;
 
-    pid_ = Root::get()->X.windowPid(window_);
-    pgid_ = Root::get()->X.windowPgid(window_);
+    pid_ = root->X.windowPid(window_);
+    pgid_ = (pid_() == -1) ? -1 : getpgid(pid_());
 
     update_title();
     update_wm_hints();
@@ -129,7 +134,13 @@ void Client::listen_for_events() {
 }
 
 void Client::setTag(HSTag *tag) {
+    if (tag_) {
+        tag_->adjustClientCounts(-1, urgent_() ? -1 : 0);
+    }
     tag_ = tag;
+    if (tag_) {
+        tag_->adjustClientCounts(1, urgent_() ? 1 : 0);
+    }
     ewmh.windowUpdateTag(window_, tag);
 }
 
@@ -152,6 +163,9 @@ Client* get_client_from_window(Window window) {
 
 // destroys a special client
 Client::~Client() {
+    if (tag_) {
+        tag_->adjustClientCounts(-1, urgent_() ? -1 : 0);
+    }
     if (lastfocus == this) {
         lastfocus = nullptr;
     }
@@ -489,10 +503,17 @@ void Client::set_urgent(bool state) {
     set_urgent_force(state);
 }
 
+void Client::setUrgentAttribute(bool state) {
+    if (tag_ && urgent_() != state) {
+        tag_->adjustClientCounts(0, state ? 1 : -1);
+    }
+    urgent_ = state;
+}
+
 void Client::set_urgent_force(bool state) {
     hook_emit({"urgent", state ? "on" : "off", WindowID(window_).str() });
 
-    this->urgent_ = state;
+    setUrgentAttribute(state);
 
     setup_border(this == manager.focus());
 
@@ -532,7 +553,7 @@ void Client::update_wm_hints() {
     } else {
         bool newval = (wmh->flags & XUrgencyHint) ? true : false;
         if (newval != this->urgent_()) {
-            this->urgent_ = newval;
+            setUrgentAttribute(newval);
             this->setup_border(focused_client == this);
             hook_emit({"urgent", urgent_() ? "on":"off", WindowID(window_).str()});
             tag_set_flags_dirty();
@@ -568,12 +589,67 @@ void Client::updateEwmhState() {
 
 string Client::getWindowClass()
 {
-    return ewmh.X().getClass(window_);
+    return windowClass();
 }
 
 string Client::getWindowInstance()
 {
-    return ewmh.X().getInstance(window_);
+    return windowInstance();
+}
+
+void Client::fetchClassHint() const {
+    if (!classHintFetched_) {
+        auto hint = backend.windowClass(window_);
+        windowInstanceCache_ = hint.first;
+        windowClassCache_ = hint.second;
+        classHintFetched_ = true;
+    }
+}
+
+void Client::setClassHint(const pair<string, string>& hint) {
+    windowInstanceCache_ = hint.first;
+    windowClassCache_ = hint.second;
+    classHintFetched_ = true;
+}
+
+const string& Client::windowClass() const {
+    fetchClassHint();
+    return windowClassCache_;
+}
+
+const string& Client::windowInstance() const {
+    fetchClassHint();
+    return windowInstanceCache_;
+}
+
+int Client::windowType() const {
+    if (!windowTypeFetched_) {
+        windowTypeCache_ = ewmh.getWindowType(window_);
+        windowTypeFetched_ = true;
+    }
+    return windowTypeCache_;
+}
+
+const std::experimental::optional<string>& Client::windowRole() const {
+    if (!windowRoleFetched_) {
+        auto& X = ewmh.X();
+        windowRoleCache_ = X.getWindowProperty(window_, X.atom("WM_WINDOW_ROLE"));
+        windowRoleFetched_ = true;
+    }
+    return windowRoleCache_;
+}
+
+//! drop the cached value of the given property such that
+//! it is fetched again on the next access
+void Client::propertyChanged(Atom atom) {
+    auto& X = ewmh.X();
+    if (atom == XA_WM_CLASS) {
+        classHintFetched_ = false;
+    } else if (atom == ewmh.netatom(NetWmWindowType)) {
+        windowTypeFetched_ = false;
+    } else if (atom == X.atom("WM_WINDOW_ROLE")) {
+        windowRoleFetched_ = false;
+    }
 }
 
 void Client::requestRedraw()
@@ -6,13 +6,16 @@
 
 #include "attribute_.h"
 #include "object.h"
+#include "optional.h"
 #include "regexstr.h"
 #include "types.h"
 #include "x11-types.h"
 
 class Decoration;
 class DecTriple;
+class DisplayBackend;
 class Ewmh;
+class FrameLeaf;
 class Slice;
 class HSTag;
 class Monitor;
@@ -31,6 +34,9 @@ public:
     Rectangle   float_size_ = {0, 0, 100, 100};     // floating size without the window border
     HSTag*      tag_ = {};
     Slice* slice = {};
+    //! the frame containing this client, if the client is tiled.
+    //! This is maintained by the FrameLeaf.
+    std::weak_ptr<FrameLeaf> frameLeaf_;
     bool        ewmhfullscreen_ = false; // ewmh fullscreen state
     bool        neverfocus_ = false; // do not give the focus via XSetInputFocus
     bool        visible_;
@@ -114,13 +120,28 @@ public:
     void set_visible(bool visible_);
 
     void set_urgent_force(bool state);
+    //! set urgent_ and keep the tag's urgent count in sync
+    void setUrgentAttribute(bool state);
     void requestClose(); //! ask the client to close
 
     void clear_properties();
     bool ignore_unmapnotify();
 
     void updateEwmhState();
+
+    // window properties that are read repeatedly (e.g. by the rules). They
+    // are fetched from the X server on first use and cached until
+    // propertyChanged() is called for the respective atom.
+    const std::string& windowClass() const;
+    const std::string& windowInstance() const;
+    int windowType() const; //! see Ewmh::getWindowType()
+    const std::experimental::optional<std::string>& windowRole() const;
+    //! fill the cache of windowInstance() and windowClass() with the
+    //! given WM_CLASS, if it was fetched before the client was created
+    void setClassHint(const std::pair<std::string, std::string>& hint);
+    void propertyChanged(Atom atom);
 private:
+    void fetchClassHint() const;
     std::string getWindowClass();
     std::string getWindowInstance();
     std::string triggerRelayoutMonitor();
@@ -130,8 +151,18 @@ private:
     Theme& theme;
     Settings& settings;
     Ewmh& ewmh;
+    DisplayBackend& backend;
     std::string tagName();
     const DecTriple& getDecTriple();
+
+    // the property cache
+    mutable bool classHintFetched_ = false;
+    mutable std::string windowClassCache_;
+    mutable std::string windowInstanceCache_;
+    mutable bool windowTypeFetched_ = false;
+    mutable int windowTypeCache_ = -1;
+    mutable bool windowRoleFetched_ = false;
+    mutable std::experimental::optional<std::string> windowRoleCache_;
 };
 
 
@@ -8,6 +8,7 @@
 #include "client.h"
 #include "completion.h"
 #include "decoration.h"
+#include "displaybackend.h"
 #include "ewmh.h"
 #include "globals.h"
 #include "ipc-protocol.h"
@@ -50,10 +51,11 @@ ClientManager::~ClientManager()
     }
 }
 
-void ClientManager::injectDependencies(Settings* s, Theme* t, Ewmh* e) {
+void ClientManager::injectDependencies(Settings* s, Theme* t, Ewmh* e, DisplayBackend* b) {
     settings = s;
     theme = t;
     ewmh = e;
+    backend = b;
 }
 
 Client* ClientManager::client(Window window)
@@ -132,22 +134,25 @@ void ClientManager::remove(Window window)
 
 Client* ClientManager::manage_client(Window win, bool visible_already, bool force_unmanage,
                                      function<void(ClientChanges&)> additionalRules) {
-    if (is_herbstluft_window(g_display, win)) {
-        // ignore our own window
+    if (client(win)) { // if the client is managed already
         return nullptr;
     }
 
-    if (client(win)) { // if the client is managed already
+    // check the class before creating the client (and its decoration
+    // windows), and hand the result on to the rules via the client's cache
+    auto classHint = backend->windowClass(win);
+    if (is_herbstluft_class(classHint.second)) {
+        // ignore our own window
         return nullptr;
     }
-
     // init client
     auto client = new Client(win, visible_already, *this);
+    client->setClassHint(classHint);
     client->listen_for_events();
     Monitor* m = get_current_monitor();
 
     // apply rules
-    ClientChanges changes = applyDefaultRules(client->window_);
+    ClientChanges changes = applyDefaultRules(client);
     if (additionalRules) {
         additionalRules(changes);
     }
@@ -190,7 +195,9 @@ Client* ClientManager::manage_client(Window win, bool visible_already, bool forc
         client->setTag(m->tag);
     }
     // insert window to the stack
-    client->slice = Slice::makeClientSlice(client);
+    client->slice = Slice::makeClientSlice(client, client->x11Window(),
+                                           client->decorationWindow(),
+                                           client->floating_());
     client->tag()->insertClientSlice(client);
     // insert window to the tag
     client->tag()->insertClient(client, changes.tree_index, changes.focus);
@@ -240,10 +247,10 @@ Client* ClientManager::manage_client(Window win, bool visible_already, bool forc
 
 //! apply some built in rules that reflect the EWMH specification
 //! and regarding sensible single-window floating settings
-ClientChanges ClientManager::applyDefaultRules(Window win)
+ClientChanges ClientManager::applyDefaultRules(Client* client)
 {
     ClientChanges changes;
-    const int windowType = ewmh->getWindowType(win);
+    const int windowType = client->windowType();
     vector<int> unmanaged= {
         NetWmWindowTypeDesktop,
         NetWmWindowTypeDock,
@@ -270,7 +277,7 @@ ClientChanges ClientManager::applyDefaultRules(Window win)
     {
         changes.floating = True;
     }
-    if (ewmh->X().getTransientForHint(win).has_value()) {
+    if (ewmh->X().getTransientForHint(client->window_).has_value()) {
         changes.floating = true;
     }
     return changes;
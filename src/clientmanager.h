@@ -10,6 +10,7 @@
 
 class Client;
 class ClientChanges;
+class DisplayBackend;
 class Completion;
 class Ewmh;
 class HSTag;
@@ -23,7 +24,7 @@ class ClientManager : public Object
 public:
     ClientManager();
     ~ClientManager() override;
-    void injectDependencies(Settings* s, Theme* t, Ewmh* e);
+    void injectDependencies(Settings* s, Theme* t, Ewmh* e, DisplayBackend* b);
 
     Client* client(Window window);
     Client* client(const std::string &identifier);
@@ -53,7 +54,7 @@ public:
     // adds a new client to list of managed client windows
     Client* manage_client(Window win, bool visible_already, bool force_unmanage,
                           std::function<void(ClientChanges&)> additionalRules = {});
-    ClientChanges applyDefaultRules(Window win);
+    ClientChanges applyDefaultRules(Client* client);
 
     int applyRulesCmd(Input input, Output output);
     int applyRules(Client* client, Output output, bool changeFocus = true);
@@ -65,6 +66,7 @@ protected:
     Theme* theme;
     Settings* settings;
     Ewmh* ewmh;
+    DisplayBackend* backend;
     std::unordered_map<Window, Client*> clients_;
     friend class Client;
 };
@@ -1,5 +1,7 @@
 #include "command.h"
 
+#include <X11/Xlib.h>
+#include <chrono>
 #include <cstdio>
 #include <cstring>
 #include <sstream>
@@ -11,9 +13,14 @@
 #include "monitor.h"
 #include "monitormanager.h"
 #include "root.h"
+#include "stats.h"
 #include "tag.h"
 #include "utils.h"
+#include "xconnection.h"
 
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using std::chrono::steady_clock;
 using std::endl;
 using std::function;
 using std::shared_ptr;
@@ -174,22 +181,20 @@ function <int(Input,Output)> CommandBinding::commandFromCFunc(
         function <int(int argc, char**argv, Output output)> func) {
     return [func](Input args, Output out) {
         /* Note that instead of copying the arguments, we point to their
-         * original location here. This only works because Input stores its
-         * payload in shared pointers and other references to them are held
-         * until the command is finished.
+         * original location here. The argument container may be shared
+         * with other commands, e.g. with a key binding, so the commands
+         * must not modify the strings. They may only modify the argv
+         * array itself, which is private to this call.
          */
-        shared_ptr<char*> argv(new char*[args.size() + 1],
-                std::default_delete<char*[]>());
-
-        // Most of the commands want a char**, not a const char**. Let's
-        // hope, they don't actually modify it.
-        argv.get()[0] = const_cast<char*>(args.command().c_str());
-        auto elem = args.begin();
-        for (size_t i = 0; i < args.size(); i++, elem++) {
-            argv.get()[i+1] = const_cast<char*>(elem->c_str());
+        vector<char*> argv;
+        argv.reserve(args.size() + 2);
+        argv.push_back(const_cast<char*>(args.command().c_str()));
+        for (auto& arg : args) {
+            argv.push_back(const_cast<char*>(arg.c_str()));
         }
+        argv.push_back(nullptr);
 
-        return func(args.size() + 1, argv.get(), out);
+        return func(static_cast<int>(argv.size() - 1), argv.data(), out);
     };
 }
 
@@ -234,7 +239,20 @@ int CommandTable::callCommand(Input args, Output out) const {
         return HERBST_COMMAND_NOT_FOUND;
     }
 
-    return cmd->second(args, out);
+    auto root = Root::get();
+    if (!root) {
+        return cmd->second(args, out);
+    }
+    Display* display = root->X.display();
+    auto start = steady_clock::now();
+    unsigned long firstRequest = NextRequest(display);
+    int status = cmd->second(args, out);
+    auto duration = steady_clock::now() - start;
+    root->stats->commands->record(
+                args.command(),
+                duration_cast<microseconds>(duration),
+                NextRequest(display) - firstRequest);
+    return status;
 }
 
 namespace Commands {
@@ -454,10 +472,16 @@ int complete_command(int argc, char** argv, Output output) {
     int position = CLAMP(atoi(argv[1]), 0, argc-2);
     (void)SHIFT(argc, argv);
     (void)SHIFT(argc, argv);
+    // the strings in argv must not be modified, so unquote copies of them
+    vector<string> unquoted;
+    vector<char*> unquotedArgv;
     if (g_shell_quoting) {
-        for (int i = 0; i < argc; i++) {
-            posix_sh_compress_inplace(argv[i]);
+        unquoted.assign(argv, argv + argc);
+        for (auto& arg : unquoted) {
+            posix_sh_compress_inplace(&arg[0]);
+            unquotedArgv.push_back(&arg[0]);
         }
+        argv = unquotedArgv.data();
     }
     return complete_against_commands(argc, argv, position, output);
 }
@@ -4,6 +4,7 @@
 #include <X11/Xutil.h>
 
 #include "client.h"
+#include "displaybackend.h"
 #include "ewmh.h"
 #include "globals.h"
 #include "settings.h"
@@ -30,9 +31,10 @@ static Visual* check_32bit_client(Client* c)
     return nullptr;
 }
 
-Decoration::Decoration(Client* client, Settings& settings)
+Decoration::Decoration(Client* client, Settings& settings, DisplayBackend& backend)
     : client_(client),
-      settings_(settings)
+      settings_(settings),
+      backend_(backend)
 {
 }
 
@@ -208,14 +210,6 @@ void Decoration::resize_outline(Rectangle outline, const DecorationScheme& schem
     last_inner_rect = inner;
     inner.x -= outline.x;
     inner.y -= outline.y;
-    XWindowChanges changes;
-    changes.x = inner.x;
-    changes.y = inner.y;
-    changes.width = inner.width;
-    changes.height = inner.height;
-    changes.border_width = 0;
-
-    int mask = CWX | CWY | CWWidth | CWHeight | CWBorderWidth;
     //if (*g_window_border_inner_width > 0
     //    && *g_window_border_inner_width < *g_window_border_width) {
     //    unsigned long current_border_color = get_window_border_color(client);
@@ -237,30 +231,24 @@ void Decoration::resize_outline(Rectangle outline, const DecorationScheme& schem
     // redraw
     // TODO: reduce flickering
     if (!client_->dragged_ || settings_.update_dragged_clients()) {
-        last_actual_rect.x = changes.x;
-        last_actual_rect.y = changes.y;
-        last_actual_rect.width = changes.width;
-        last_actual_rect.height = changes.height;
+        last_actual_rect = inner;
     }
     redrawPixmap();
-    XSetWindowBackgroundPixmap(g_display, decwin, pixmap);
+    backend_.setWindowBackground(decwin, pixmap);
     if (!size_changed) {
         // if size changes, then the window is cleared automatically
-        XClearWindow(g_display, decwin);
+        backend_.clearWindow(decwin);
     }
     if (!client_->dragged_ || settings_.update_dragged_clients()) {
-        XConfigureWindow(g_display, win, mask, &changes);
-        XMoveResizeWindow(g_display, bgwin,
-                          changes.x, changes.y,
-                          changes.width, changes.height);
+        backend_.configureClientWindow(win, inner);
+        backend_.moveResizeWindow(bgwin, inner);
     }
-    XMoveResizeWindow(g_display, decwin,
-                      outline.x, outline.y, outline.width, outline.height);
+    backend_.moveResizeWindow(decwin, outline);
     updateFrameExtends();
     if (!client_->dragged_ || settings_.update_dragged_clients()) {
         client_->send_configure();
     }
-    XSync(g_display, False);
+    backend_.sync();
 }
 
 void Decoration::updateFrameExtends() {
@@ -7,12 +7,13 @@
 #include "x11-types.h"
 
 class Client;
+class DisplayBackend;
 class Settings;
 class DecorationScheme;
 
 class Decoration {
 public:
-    Decoration(Client* client_, Settings& settings_);
+    Decoration(Client* client_, Settings& settings_, DisplayBackend& backend_);
     void createWindow();
     virtual ~Decoration();
     // resize such that the decorated outline of the window fits into rect
@@ -55,6 +56,7 @@ private:
 private:
     Client* client_; // the client to decorate
     Settings& settings_;
+    DisplayBackend& backend_;
     static std::map<Window,Client*> decwin2client;
 };
 
@@ -0,0 +1,42 @@
+#ifndef HERBSTLUFT_DISPLAYBACKEND_H
+#define HERBSTLUFT_DISPLAYBACKEND_H
+
+#include <X11/X.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "x11-types.h"
+
+/*! The requests to the display server that the X-independent parts of
+ * herbstluftwm send. XBackend passes them on to the X server and
+ * RecordingBackend only records them, e.g. for the unit tests.
+ */
+class DisplayBackend {
+public:
+    virtual ~DisplayBackend() = default;
+
+    //! the instance and the class name in the WM_CLASS of the window, or
+    //! empty strings if the window has none
+    virtual std::pair<std::string, std::string> windowClass(Window window) = 0;
+
+    //! stack the windows from top to bottom
+    virtual void restackWindows(const std::vector<Window>& windows) = 0;
+
+    //! move and resize the window
+    virtual void moveResizeWindow(Window window, Rectangle geometry) = 0;
+
+    //! move and resize the window of a client and remove its border
+    virtual void configureClientWindow(Window window, Rectangle geometry) = 0;
+
+    //! set the background of the window to the pixmap
+    virtual void setWindowBackground(Window window, Pixmap pixmap) = 0;
+
+    //! repaint the entire window with its background
+    virtual void clearWindow(Window window) = 0;
+
+    //! wait until the display server has processed all requests
+    virtual void sync() = 0;
+};
+
+#endif
@@ -15,8 +15,12 @@ static const char* g_layout_names[] = {
     "horizontal",
     "max",
     "grid",
+    "master",
     nullptr,
 };
+static_assert(sizeof(g_layout_names) / sizeof(g_layout_names[0])
+              == LAYOUT_ALGORITHM_COUNT + 1,
+              "every LayoutAlgorithm needs a name");
 
 size_t layoutAlgorithmCount() {
     size_t i = 0;
@@ -37,8 +37,14 @@ enum class LayoutAlgorithm {
     horizontal,
     max,
     grid,
+    master,
 };
 
+//! the number of LayoutAlgorithm values, i.e. one more than the last one.
+//! The tables of layout names and layout engines must have this size.
+const size_t LAYOUT_ALGORITHM_COUNT =
+    static_cast<size_t>(LayoutAlgorithm::master) + 1;
+
 ConverterInstance(LayoutAlgorithm)
 template<> void Converter<LayoutAlgorithm>::complete(Completion& complete, LayoutAlgorithm const* relativeTo);
 
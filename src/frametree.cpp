@@ -23,6 +23,7 @@ using std::endl;
 using std::function;
 using std::make_shared;
 using std::shared_ptr;
+using std::static_pointer_cast;
 using std::string;
 using std::vector;
 
@@ -30,6 +31,7 @@ FrameTree::FrameTree(HSTag* tag, Settings* settings)
     : rootLink_(*this, "root")
     , tag_(tag)
     , settings_(settings)
+    , leafCount_(1)
 {
     root_ = make_shared<FrameLeaf>(tag, settings, shared_ptr<FrameSplit>());
     rootLink_ = root_.get();
@@ -37,11 +39,6 @@ FrameTree::FrameTree(HSTag* tag, Settings* settings)
     (void) settings_;
 }
 
-void FrameTree::foreachClient(function<void(Client*)> action)
-{
-    root_->foreachClient(action);
-}
-
 void FrameTree::dump(shared_ptr<Frame> frame, Output output)
 {
     auto l = frame->isLeaf();
@@ -128,12 +125,10 @@ shared_ptr<FrameLeaf> FrameTree::focusedFrame() {
 /*! get the focused frame within the subtree of the given node
  */
 shared_ptr<FrameLeaf> FrameTree::focusedFrame(shared_ptr<Frame> node) {
-    while (node->isLeaf() == nullptr) {
-        // node must be a frame split
-        auto s = node->isSplit();
-        node = (s->selection_ == 0) ? s->a_ : s->b_;
+    for (auto s = node->isSplit(); s; s = node->isSplit()) {
+        node = s->selectedChild();
     }
-    assert(node->isLeaf() != nullptr);
+    // if it is not a split, it must be a leaf
     return node->isLeaf();
 }
 
@@ -286,11 +281,11 @@ shared_ptr<TreeInterface> FrameTree::treeInterface(
     };
     return frame->switchcase<shared_ptr<TreeInterface>>(
         [focus] (shared_ptr<FrameLeaf> l) {
-            return std::static_pointer_cast<TreeInterface>(
+            return static_pointer_cast<TreeInterface>(
                     make_shared<LeafTI>(l, focus));
         },
         [focus] (shared_ptr<FrameSplit> s) {
-            return std::static_pointer_cast<TreeInterface>(
+            return static_pointer_cast<TreeInterface>(
                     make_shared<SplitTI>(s, focus));
         }
     );
@@ -304,7 +299,8 @@ void FrameTree::prettyPrint(shared_ptr<Frame> frame, Output output) {
 shared_ptr<FrameLeaf> FrameTree::findEmptyFrameNearFocusGeometrically(shared_ptr<Frame> subtree)
 {
     // render frame geometries.
-    TilingResult tileres = subtree->computeLayout({0, 0, 800, 800});
+    TilingResult tileres;
+    subtree->computeLayout({0, 0, 800, 800}, tileres);
     function<Rectangle(shared_ptr<FrameLeaf>)> frame2geometry =
             [tileres] (shared_ptr<FrameLeaf> frame) -> Rectangle {
         for (auto& framedata : tileres.frames) {
@@ -369,16 +365,21 @@ shared_ptr<FrameLeaf> FrameTree::findEmptyFrameNearFocus(shared_ptr<Frame> subtr
 }
 
 shared_ptr<FrameLeaf> FrameTree::findFrameWithClient(Client* client) {
-    shared_ptr<FrameLeaf> frame = {};
+    return root_->frameWithClient(client);
+}
+
+bool FrameTree::clientFramesConsistent() {
+    bool consistent = true;
     root_->fmap(
         [](FrameSplit*) {},
         [&](FrameLeaf* l) {
-            auto& cs = l->clients;
-            if (std::find(cs.begin(), cs.end(), client) != cs.end()) {
-                frame = l->thisLeaf();
+            for (auto client : l->clients) {
+                if (client->frameLeaf_.lock().get() != l) {
+                    consistent = false;
+                }
             }
         });
-    return frame;
+    return consistent;
 }
 
 bool FrameTree::contains(shared_ptr<Frame> frame) const
@@ -688,7 +689,8 @@ void FrameTree::applyFrameTree(shared_ptr<Frame> target,
             targetSplit = {};
         }
         // make the targetLeaf look like the sourceLeaf
-        targetLeaf->clients = clients;
+        targetLeaf->removeAllClients();
+        targetLeaf->addClients(clients);
         targetLeaf->setSelection(sourceLeaf->selection);
         targetLeaf->layout = sourceLeaf->layout;
     } else {
@@ -710,6 +712,7 @@ void FrameTree::applyFrameTree(shared_ptr<Frame> target,
 
 void FrameTree::replaceNode(shared_ptr<Frame> old,
                             shared_ptr<Frame> replacement) {
+    leafCount_ += countLeaves(replacement) - countLeaves(old);
     auto parent = old->getParent();
     if (!parent) {
         assert(old == root_);
@@ -722,6 +725,14 @@ void FrameTree::replaceNode(shared_ptr<Frame> old,
     }
 }
 
+int FrameTree::countLeaves(shared_ptr<Frame> frame) {
+    int count = 0;
+    frame->fmap([](FrameSplit*) {},
+                [&count](FrameLeaf*) { count++; },
+                0);
+    return count;
+}
+
 int FrameTree::cycleLayoutCommand(Input input, Output output) {
     int delta = 1;
     auto cur_frame = focusedFrame();
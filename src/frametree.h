@@ -6,6 +6,7 @@
 #include <string>
 
 #include "fixprecdec.h"
+#include "layout.h"
 #include "link.h"
 #include "object.h"
 #include "types.h"
@@ -25,7 +26,8 @@ class TreeInterface;
 class FrameTree : public Object {
 public:
     FrameTree(HSTag* tag, Settings* settings);
-    void foreachClient(std::function<void(Client*)> action);
+    template <typename ClientAction>
+    void foreachClient(ClientAction&& action);
 
     static void dump(std::shared_ptr<Frame> frame, Output output);
     static void prettyPrint(std::shared_ptr<Frame> frame, Output output);
@@ -40,6 +42,11 @@ public:
     bool focusInDirection(Direction dir, bool externalOnly);
     //! return a frame in the tree that holds the client
     std::shared_ptr<FrameLeaf> findFrameWithClient(Client* client);
+    //! check that every client in the tree refers to the frame containing
+    //! it, i.e. that Client::frameLeaf_ is up to date (for debugging)
+    bool clientFramesConsistent();
+    //! the number of frame leaves in the tree, maintained by replaceNode()
+    int leafCount() const { return leafCount_; }
 
     //! check whether the present FrameTree contains a given Frame
     //! (it requires that there are no cycles in the 'tree' containing the Frame
@@ -84,8 +91,15 @@ private:
     static std::shared_ptr<TreeInterface> treeInterface(
         std::shared_ptr<Frame> frame,
         std::shared_ptr<FrameLeaf> focus);
+    static int countLeaves(std::shared_ptr<Frame> frame);
     HSTag* tag_;
     Settings* settings_;
+    int leafCount_;
 };
 
+template <typename ClientAction>
+void FrameTree::foreachClient(ClientAction&& action) {
+    root_->foreachClient(action);
+}
+
 #endif
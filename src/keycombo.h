@@ -75,3 +75,13 @@ public:
 
     KeySym keysym = {};
 };
+
+namespace std {
+//! hash key combos, such that they can be used in unordered containers
+template<> struct hash<KeyCombo> {
+    size_t operator()(const KeyCombo& combo) const {
+        return hash<KeySym>()(combo.keysym)
+            ^ (hash<unsigned int>()(combo.modifiers_) << 1);
+    }
+};
+}
@@ -16,8 +16,18 @@
 #include "utils.h"
 
 using std::endl;
+using std::make_pair;
 using std::string;
 using std::unique_ptr;
+using std::vector;
+
+KeyManager::KeyManager()
+    : grabRequests_(this, "grab_requests",
+                    [this]() { return xKeyGrabber_.grabRequests(); })
+    , ungrabRequests_(this, "ungrab_requests",
+                      [this]() { return xKeyGrabber_.ungrabRequests(); })
+{
+}
 
 KeyManager::~KeyManager() {
     xKeyGrabber_.ungrabAll();
@@ -39,19 +49,16 @@ int KeyManager::addKeybindCommand(Input input, Output output) {
 
     input.shift();
     // Store remaining input as the associated command
-    newBinding->cmd = {input.begin(), input.end()};
+    newBinding->cmd = input.fromHere();
 
     // newBinding->cmd is not empty because the size before the input.shift() was >= 2
-    if (!Commands::commandExists(newBinding->cmd[0])) {
+    if (!Commands::commandExists(newBinding->cmd.command())) {
         output << input.command() << ": the command \""
-               << newBinding->cmd[0] << "\" does not exist."
+               << newBinding->cmd.command() << "\" does not exist."
                << " Did you forget \"spawn\"?\n";
         return HERBST_COMMAND_NOT_FOUND;
     }
 
-    // Make sure there is no existing binding with same keysym/modifiers
-    removeKeyBinding(newBinding->keyCombo);
-
     if (currentKeyMask_.allowsBinding(newBinding->keyCombo)
         && currentKeysInactive_.allowsBinding(newBinding->keyCombo))
     {
@@ -60,8 +67,15 @@ int KeyManager::addKeybindCommand(Input input, Output output) {
         newBinding->grabbed = true;
     }
 
+    // Make sure there is no existing binding with same keysym/modifiers.
+    // This is done after grabbing the new binding, such that rebinding
+    // a grabbed key does not cause any X requests.
+    removeKeyBinding(newBinding->keyCombo);
+
     // Add keybinding to list
+    bindsByCombo_[newBinding->keyCombo] = newBinding.get();
     binds.push_back(std::move(newBinding));
+    bindingsChanged();
 
     ensureKeyMask();
 
@@ -73,7 +87,10 @@ int KeyManager::listKeybindsCommand(Output output) const {
         // add key combo
         output << binding->keyCombo.str();
         // add associated command
-        output << "\t" << ArgList(binding->cmd).join('\t');
+        output << "\t" << binding->cmd.command();
+        for (const auto& arg : binding->cmd) {
+            output << "\t" << arg;
+        }
         output << "\n";
     }
     return 0;
@@ -87,6 +104,8 @@ int KeyManager::removeKeybindCommand(Input input, Output output) {
 
     if (arg == "--all" || arg == "-F") {
         binds.clear();
+        bindsByCombo_.clear();
+        bindingsChanged();
         xKeyGrabber_.ungrabAll();
     } else {
         KeyCombo comboToRemove = {};
@@ -98,9 +117,7 @@ int KeyManager::removeKeybindCommand(Input input, Output output) {
         }
 
         // Remove binding (or moan if none was found)
-        if (removeKeyBinding(comboToRemove)) {
-            regrabAll();
-        } else {
+        if (!removeKeyBinding(comboToRemove)) {
             output << input.command() << ": Key \"" << arg << "\" is not bound\n";
         }
     }
@@ -129,16 +146,11 @@ void KeyManager::removeKeybindCompletion(Completion &complete) {
 void KeyManager::handleKeyPress(XKeyEvent* ev) const {
     KeyCombo pressed = xKeyGrabber_.xEventToKeyCombo(ev);
 
-    auto found = std::find_if(binds.begin(), binds.end(),
-            [=](const unique_ptr<KeyBinding> &other) {
-                return pressed == other->keyCombo;
-            });
-    if (found != binds.end()) {
+    auto found = bindsByCombo_.find(pressed);
+    if (found != bindsByCombo_.end()) {
         // execute the bound command
         std::ostringstream discardedOutput;
-        auto& cmd = (*found)->cmd;
-        Input input(cmd.front(), {cmd.begin() + 1, cmd.end()});
-        Commands::call(input, discardedOutput);
+        Commands::call(found->second->cmd, discardedOutput);
     }
 }
 
@@ -192,10 +204,10 @@ void KeyManager::ensureKeyMask(const Client* client) {
 
 //! Apply new keymask by grabbing/ungrabbing current bindings accordingly
 void KeyManager::setActiveKeyMask(const KeyMask& keyMask, const KeyMask& keysInactive) {
-    for (auto& binding : binds) {
-        auto name = binding->keyCombo.str();
-        bool isAllowed = keysInactive.allowsBinding(binding->keyCombo)
-                         && keyMask.allowsBinding(binding->keyCombo);
+    const vector<bool>& allowed = allowedBindings(keyMask, keysInactive);
+    for (size_t i = 0; i < binds.size(); i++) {
+        auto& binding = binds[i];
+        bool isAllowed = allowed[i];
         if (isAllowed && !binding->grabbed) {
             xKeyGrabber_.grabKeyCombo(binding->keyCombo);
             binding->grabbed = true;
@@ -214,7 +226,34 @@ void KeyManager::clearActiveKeyMask() {
 }
 
 /*!
- * Removes a given key combo from the list of bindings (no ungrabbing)
+ * For each of the current bindings, tell whether it is allowed by the given
+ * keymasks. The result is cached, such that the regexes only need to be
+ * evaluated once per combination of keymasks.
+ */
+const vector<bool>& KeyManager::allowedBindings(const KeyMask& keyMask,
+                                                const KeyMask& keysInactive)
+{
+    auto key = make_pair(keyMask.id(), keysInactive.id());
+    auto it = allowedBindingsCache_.find(key);
+    if (it != allowedBindingsCache_.end()) {
+        return it->second;
+    }
+    vector<bool>& allowed = allowedBindingsCache_[key];
+    allowed.reserve(binds.size());
+    for (auto& binding : binds) {
+        allowed.push_back(keysInactive.allowsBinding(binding->keyCombo)
+                          && keyMask.allowsBinding(binding->keyCombo));
+    }
+    return allowed;
+}
+
+//! Drop all information derived from the list of bindings
+void KeyManager::bindingsChanged() {
+    allowedBindingsCache_.clear();
+}
+
+/*!
+ * Removes a given key combo from the list of bindings and ungrabs it
  *
  * \return True if a matching binding was found and removed
  * \return False if no matching binding was found
@@ -233,7 +272,12 @@ bool KeyManager::removeKeyBinding(const KeyCombo& comboToRemove) {
     }
 
     // Remove binding
+    if ((*removeIter)->grabbed) {
+        xKeyGrabber_.ungrabKeyCombo((*removeIter)->keyCombo);
+    }
+    bindsByCombo_.erase((*removeIter)->keyCombo);
     binds.erase(removeIter);
+    bindingsChanged();
     return True;
 }
 
@@ -1,10 +1,14 @@
 #pragma once
 
 #include <X11/Xlib.h>
+#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "attribute_.h"
 #include "keycombo.h"
 #include "object.h"
 #include "regexstr.h"
@@ -42,6 +46,10 @@ private:
 
         bool allowsBinding(const KeyCombo& combo) const;
         std::string str() const { return regex_.str(); }
+        //! a string that identifies the behaviour of the keymask
+        std::string id() const {
+            return regex_.empty() ? "" : ((negated_ ? "!" : "=") + regex_.str());
+        }
 
         bool operator==(const KeyMask& other) const {
             return  (other.regex_.empty() && regex_.empty())
@@ -59,12 +67,13 @@ private:
     class KeyBinding {
     public:
         KeyCombo keyCombo;
-        std::vector<std::string> cmd;
+        //! the bound command, parsed once when binding the key
+        Input cmd = {""};
         bool grabbed = false;
     };
 
 public:
-    KeyManager() = default;
+    KeyManager();
     ~KeyManager();
 
     int addKeybindCommand(Input input, Output output);
@@ -89,12 +98,23 @@ public:
 
 private:
     bool removeKeyBinding(const KeyCombo& comboToRemove);
+    const std::vector<bool>& allowedBindings(const KeyMask& keyMask,
+                                             const KeyMask& keysInactive);
+    void bindingsChanged();
 
     //! Currently defined keybindings
     std::vector<std::unique_ptr<KeyBinding>> binds;
+    //! The bindings in 'binds', indexed by their (normalized) key combo
+    std::unordered_map<KeyCombo, KeyBinding*> bindsByCombo_;
+    //! For pairs of keymask and keys_inactive (given by KeyMask::id()),
+    //! which of the 'binds' are allowed. Reset whenever 'binds' changes.
+    std::map<std::pair<std::string, std::string>, std::vector<bool>> allowedBindingsCache_;
 
     XKeyGrabber xKeyGrabber_;
 
+    DynAttribute_<unsigned long> grabRequests_;
+    DynAttribute_<unsigned long> ungrabRequests_;
+
     // The last applies KeyMask & KeysInactive(for comparison on change)
     KeyMask currentKeyMask_;
     KeyMask currentKeysInactive_;
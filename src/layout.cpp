@@ -13,17 +13,17 @@
 #include "frametree.h" // TODO: remove this dependency!
 #include "globals.h"
 #include "ipc-protocol.h"
+#include "layoutengine.h"
 #include "monitor.h"
 #include "monitormanager.h"
 #include "settings.h"
 #include "tagmanager.h"
 #include "utils.h"
 
-using std::dynamic_pointer_cast;
-using std::function;
 using std::make_shared;
 using std::shared_ptr;
 using std::string;
+using std::static_pointer_cast;
 using std::swap;
 using std::vector;
 using std::weak_ptr;
@@ -77,6 +77,7 @@ void FrameLeaf::insertClient(Client* client, bool focus) {
     // insert it after the selection
     int index = std::min((selection + 1), (int)clients.size());
     clients.insert(clients.begin() + index, client);
+    client->frameLeaf_ = thisLeaf();
     if (focus) {
         selection = index;
     }
@@ -85,16 +86,19 @@ void FrameLeaf::insertClient(Client* client, bool focus) {
 }
 
 shared_ptr<FrameLeaf> FrameSplit::frameWithClient(Client* client) {
-    auto found = a_->frameWithClient(client);
-    if (found) {
-        return found;
-    } else {
-        return b_->frameWithClient(client);
+    auto leaf = client->frameLeaf_.lock();
+    // check that the frame of the client is in this subtree
+    for (shared_ptr<Frame> node = leaf; node; node = node->getParent()) {
+        if (node.get() == this) {
+            return leaf;
+        }
     }
+    return shared_ptr<FrameLeaf>();
 }
 
 shared_ptr<FrameLeaf> FrameLeaf::frameWithClient(Client* client) {
-    if (find(clients.begin(), clients.end(), client) != clients.end()) {
+    if (client->frameLeaf_.lock().get() == this) {
+        assert(find(clients.begin(), clients.end(), client) != clients.end());
         return thisLeaf();
     } else {
         return shared_ptr<FrameLeaf>();
@@ -102,7 +106,12 @@ shared_ptr<FrameLeaf> FrameLeaf::frameWithClient(Client* client) {
 }
 
 bool FrameLeaf::removeClient(Client* client) {
+    if (client->frameLeaf_.lock().get() != this) {
+        return false;
+    }
+    client->frameLeaf_.reset();
     auto it = find(clients.begin(), clients.end(), client);
+    assert(it != clients.end());
     if (it != clients.end()) {
         auto idx = it - clients.begin();
         clients.erase(it);
@@ -120,7 +129,8 @@ bool FrameLeaf::removeClient(Client* client) {
 }
 
 bool FrameSplit::removeClient(Client* client) {
-    return a_->removeClient(client) || b_->removeClient(client);
+    auto leaf = frameWithClient(client);
+    return leaf && leaf->removeClient(client);
 }
 
 
@@ -145,17 +155,18 @@ bool Frame::isFocused() {
     if (!p) {
         return true;
     } else {
-        return p->selectedChild() == shared_from_this()
+        return p->selectedChild().get() == this
                && p->isFocused();
     }
 }
 
+// the dynamic type of 'this' is known here, so no dynamic_cast is needed
 shared_ptr<FrameLeaf> FrameLeaf::thisLeaf() {
-    return dynamic_pointer_cast<FrameLeaf>(shared_from_this());
+    return static_pointer_cast<FrameLeaf>(shared_from_this());
 }
 
 shared_ptr<FrameSplit> FrameSplit::thisSplit() {
-    return dynamic_pointer_cast<FrameSplit>(shared_from_this());
+    return static_pointer_cast<FrameSplit>(shared_from_this());
 }
 
 shared_ptr<FrameLeaf> Frame::getGloballyFocusedFrame() {
@@ -167,7 +178,7 @@ string Frame::frameIndex() const
     auto p = parent_.lock();
     if (p) {
         string parent_index = p->frameIndex();
-        bool first_child = p->firstChild() == shared_from_this();
+        bool first_child = p->firstChild().get() == this;
         return parent_index + (first_child ? "0" : "1");
     } else {
         // this is the root
@@ -175,121 +186,18 @@ string Frame::frameIndex() const
     }
 }
 
-TilingResult FrameLeaf::layoutLinear(Rectangle rect, bool vertical) {
-    TilingResult res;
-    auto cur = rect;
-    int last_step_y;
-    int last_step_x;
-    int step_y;
-    int step_x;
-    int count = clients.size();
-    if (vertical) {
-        // only do steps in y direction
-        last_step_y = cur.height % count; // get the space on bottom
-        last_step_x = 0;
-        cur.height /= count;
-        step_y = cur.height;
-        step_x = 0;
-    } else {
-        // only do steps in x direction
-        last_step_y = 0;
-        last_step_x = cur.width % count; // get the space on the right
-        cur.width /= count;
-        step_y = 0;
-        step_x = cur.width;
-    }
-    int i = 0;
-    for (auto client : clients) {
-        // add the space, if count does not divide frameheight without remainder
-        cur.height += (i == count-1) ? last_step_y : 0;
-        cur.width += (i == count-1) ? last_step_x : 0;
-        res.add(client, TilingStep(cur));
-        cur.y += step_y;
-        cur.x += step_x;
-        i++;
-    }
-    return res;
-}
-
-TilingResult FrameLeaf::layoutMax(Rectangle rect) {
-    TilingResult res;
-    // go through all clients from top to bottom and remember
-    // whether they are still visible. The stacking order is such that
-    // the windows at the end of 'clients' are on top of the windows
-    // at the beginning of 'clients'. So start at the selection and go
-    // downwards in the stack, i.e. backwards in the 'clients' array
-    bool stillVisible = true;
-    for (size_t idx = 0; idx < clients.size(); idx++) {
-        Client* client = clients[(selection + clients.size() - idx) % clients.size()];
-        TilingStep step(rect);
-        step.visible = stillVisible;
-        // the next is only visible, if the current client is visible
-        // and if the current client is pseudotiled
-        stillVisible = stillVisible && client->pseudotile_();
-        if (client == clients[selection]) {
-            step.needsRaise = true;
-        }
-        res.add(client, step);
-    }
-    return res;
-}
-
-void frame_layout_grid_get_size(size_t count, int* res_rows, int* res_cols) {
-    unsigned cols = 0;
-    while (cols * cols < count) {
-        cols++;
-    }
-    *res_cols = cols;
-    if (*res_cols != 0) {
-        *res_rows = (count / cols) + (count % cols ? 1 : 0);
-    } else {
-        *res_rows = 0;
-    }
-}
-
-TilingResult FrameLeaf::layoutGrid(Rectangle rect) {
-    TilingResult res;
-    if (clients.empty()) {
-        return res;
-    }
-
-    int rows, cols;
-    frame_layout_grid_get_size(clients.size(), &rows, &cols);
-    int width = rect.width / cols;
-    int height = rect.height / rows;
-    int i = 0;
-    auto cur = rect; // current rectangle
-    for (int r = 0; r < rows; r++) {
-        // reset to left
-        cur.x = rect.x;
-        cur.width = width;
-        cur.height = height;
-        if (r == rows -1) {
-            // fill small pixel gap below last row
-            cur.height += rect.height % rows;
-        }
-        int count = clients.size();
-        for (int c = 0; c < cols && i < count; c++) {
-            if (settings_->gapless_grid() && (i == count - 1) // if last client
-                && (count % cols != 0)) {           // if cols remain
-                // fill remaining cols with client
-                cur.width = rect.x + rect.width - cur.x;
-            } else if (c == cols - 1) {
-                // fill small pixel gap in last col
-                cur.width += rect.width % cols;
-            }
-
-            // apply size
-            res.add(clients[i], TilingStep(cur));
-            cur.x += width;
-            i++;
-        }
-        cur.y += height;
+//! the clients of a frame leaf as seen by the layout engines
+class FrameLeafClientState : public LayoutClientState {
+public:
+    FrameLeafClientState(const vector<Client*>& clients) : clients_(clients) {}
+    bool pseudotiled(size_t index) const override {
+        return clients_[index]->pseudotile_();
     }
-    return res;
-}
+private:
+    const vector<Client*>& clients_;
+};
 
-TilingResult FrameLeaf::computeLayout(Rectangle rect) {
+void FrameLeaf::computeLayout(Rectangle rect, TilingResult& res) {
     last_rect = rect;
     if (!settings_->smart_frame_surroundings() || parent_.lock()) {
         // apply frame gap
@@ -306,16 +214,16 @@ TilingResult FrameLeaf::computeLayout(Rectangle rect) {
     rect.height = std::max(WINDOW_MIN_HEIGHT, rect.height);
 
     // move windows
-    TilingResult res;
     FrameDecorationData frame_data;
     frame_data.geometry = rect;
     frame_data.visible = true;
     frame_data.hasClients = !clients.empty();
     frame_data.hasParent = (bool)parent_.lock();
     res.focused_frame = decoration;
+    res.focus = {};
     res.add(decoration, frame_data);
     if (clients.empty()) {
-        return res;
+        return;
     }
     // whether we should omit the gap around windows:
     bool smart_window_surroundings_active =
@@ -344,39 +252,26 @@ TilingResult FrameLeaf::computeLayout(Rectangle rect) {
         rect.width  -= frame_padding * 2;
         rect.height -= frame_padding * 2;
     }
-    TilingResult layoutResult;
-    switch (layout) {
-        case LayoutAlgorithm::max:
-            layoutResult = layoutMax(rect);
-            break;
-        case LayoutAlgorithm::grid:
-            layoutResult = layoutGrid(rect);
-            break;
-        case LayoutAlgorithm::vertical:
-            layoutResult = layoutVertical(rect);
-            break;
-        case LayoutAlgorithm::horizontal:
-            layoutResult = layoutHorizontal(rect);
-            break;
-    }
-    if (smart_window_surroundings_active) {
-        for (auto& it : layoutResult.data) {
-            it.second.minimalDecoration = true;
-        }
-    } else {
-        // apply window gap: deduct 'window_gap' many pixels from
-        // bottom and right of every window:
-        for (auto& it : layoutResult.data) {
-            it.second.geometry.width -= window_gap;
-            it.second.geometry.height -= window_gap;
+    // the steps of this frame's clients start here in res.data
+    size_t firstStep = res.data.size();
+    FrameLeafClientState clientState(clients);
+    LayoutEngine::forAlgorithm(layout).apply(clients, clientState, selection,
+                                             rect, layoutOptions(), res);
+    for (size_t i = firstStep; i < res.data.size(); i++) {
+        TilingStep& step = res.data[i].second;
+        if (smart_window_surroundings_active) {
+            step.minimalDecoration = true;
+        } else {
+            // apply window gap: deduct 'window_gap' many pixels from
+            // bottom and right of every window:
+            step.geometry.width -= window_gap;
+            step.geometry.height -= window_gap;
         }
     }
-    res.mergeFrom(layoutResult);
     res.focus = clients[selection];
-    return res;
 }
 
-TilingResult FrameSplit::computeLayout(Rectangle rect) {
+void FrameSplit::computeLayout(Rectangle rect, TilingResult& res) {
     last_rect = rect;
     auto first = rect;
     auto second = rect;
@@ -389,46 +284,19 @@ TilingResult FrameSplit::computeLayout(Rectangle rect) {
         second.x += first.width;
         second.width -= first.width;
     }
-    TilingResult res;
-    auto res1 = a_->computeLayout(first);
-    auto res2 = b_->computeLayout(second);
-    res.mergeFrom(res1);
-    res.mergeFrom(res2);
-    res.focus = (selection_ == 0) ? res1.focus : res2.focus;
-    res.focused_frame = (selection_ == 0) ? res1.focused_frame : res2.focused_frame;
-    return res;
-}
-
-void FrameSplit::fmap(function<void(FrameSplit*)> onSplit, function<void(FrameLeaf*)> onLeaf, int order) {
-    if (order <= 0) {
-        onSplit(this);
-    }
-    a_->fmap(onSplit, onLeaf, order);
-    if (order == 1) {
-        onSplit(this);
-    }
-    b_->fmap(onSplit, onLeaf, order);
-    if (order >= 1) {
-        onSplit(this);
+    a_->computeLayout(first, res);
+    if (selection_ == 0) {
+        // keep the focus of the first child
+        auto focus = res.focus;
+        auto focused_frame = res.focused_frame;
+        b_->computeLayout(second, res);
+        res.focus = focus;
+        res.focused_frame = focused_frame;
+    } else {
+        b_->computeLayout(second, res);
     }
 }
 
-void FrameLeaf::fmap(function<void(FrameSplit*)> onSplit, function<void(FrameLeaf*)> onLeaf, int order) {
-    (void) onSplit;
-    (void) order;
-    onLeaf(this);
-}
-
-void Frame::foreachClient(ClientAction action) {
-    fmap([action] (FrameSplit* s) {},
-         [action] (FrameLeaf* l) {
-            for (Client* client : l->clients) {
-                action(client);
-            }
-         },
-         0);
-}
-
 int frame_current_bring(int argc, char** argv, Output output) {
     if (argc < 2) {
         return HERBST_NEED_MORE_ARGS;
@@ -518,6 +386,10 @@ void FrameSplit::replaceChild(shared_ptr<Frame> old, shared_ptr<Frame> newchild)
 void FrameLeaf::addClients(const vector<Client*>& vec, bool atFront) {
     auto targetPosition = atFront ? clients.begin() : clients.end();
     clients.insert(targetPosition, vec.begin(), vec.end());
+    auto leaf = thisLeaf();
+    for (auto client : vec) {
+        client->frameLeaf_ = leaf;
+    }
 }
 
 bool FrameLeaf::split(SplitAlign alignment, FixPrecDec fraction, size_t childrenLeaving) {
@@ -631,63 +503,20 @@ shared_ptr<Frame> FrameLeaf::neighbour(Direction direction) {
     return other;
 }
 
+LayoutOptions FrameLeaf::layoutOptions() {
+    LayoutOptions options;
+    options.gaplessGrid = settings_->gapless_grid();
+    options.masterWidthPercent = settings_->master_width_percent();
+    return options;
+}
+
 //! finds the neighbour of the selected client in the specified direction
 // within the frame
 //! returns its index or -1 if there is none
 int FrameLeaf::getInnerNeighbourIndex(Direction direction) {
-    int index = -1;
     int count = clientCount();
-    switch (getLayout()) {
-        case LayoutAlgorithm::vertical:
-            if (direction == Direction::Down) {
-                index = selection + 1;
-            }
-            if (direction == Direction::Up) {
-                index = selection - 1;
-            }
-            break;
-        case LayoutAlgorithm::horizontal:
-            if (direction == Direction::Right) {
-                index = selection + 1;
-            }
-            if (direction == Direction::Left) {
-                index = selection - 1;
-            }
-            break;
-        case LayoutAlgorithm::max:
-            break;
-        case LayoutAlgorithm::grid: {
-            int rows, cols;
-            frame_layout_grid_get_size(count, &rows, &cols);
-            if (cols == 0) {
-                break;
-            }
-            int r = selection / cols;
-            int c = selection % cols;
-            switch (direction) {
-                case Direction::Down:
-                    index = selection + cols;
-                    if (g_settings->gapless_grid() && index >= count && r == (rows - 2)) {
-                        // if grid is gapless and we're in the second-last row
-                        // then it means last client is below us
-                        index = count - 1;
-                    }
-                    break;
-                case Direction::Up: index = selection - cols; break;
-                case Direction::Right:
-                    if (c < cols - 1) {
-                        index = selection + 1;
-                    }
-                    break;
-                case Direction::Left:
-                    if (c > 0) {
-                        index = selection - 1;
-                    }
-                    break;
-            }
-            break;
-        }
-    }
+    int index = LayoutEngine::forAlgorithm(layout)
+                    .neighbourIndex(count, selection, direction, layoutOptions());
     // check that index is valid
     if (index < 0 || index >= count) {
         index = -1;
@@ -844,6 +673,9 @@ vector<Client*> FrameLeaf::removeAllClients() {
     vector<Client*> result;
     swap(result, clients);
     selection = 0;
+    for (auto client : result) {
+        client->frameLeaf_.reset();
+    }
     return result;
 }
 
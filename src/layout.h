@@ -14,14 +14,11 @@
 #include "types.h"
 #include "x11-types.h"
 
-// execute an action on an client
-// returns Success or failure.
 class Client;
-typedef std::function<void(Client*)> ClientAction;
-
 class HSTag;
 class FrameLeaf;
 class FrameSplit;
+struct LayoutOptions;
 class Settings;
 
 class Frame : public std::enable_shared_from_this<Frame>, public Object {
@@ -33,19 +30,19 @@ public:
     virtual bool removeClient(Client* client) = 0;
 
     virtual bool isFocused();
-    virtual TilingResult computeLayout(Rectangle rect) = 0;
+    //! append the layout of this subtree to 'res' and set res.focus and
+    //! res.focused_frame to the focus within this subtree
+    virtual void computeLayout(Rectangle rect, TilingResult& res) = 0;
     virtual Client* focusedClient() = 0;
 
     // do recursive for each element of the (binary) frame tree
     // if order <= 0 -> action(node); action(left); action(right);
     // if order == 1 -> action(left); action(node); action(right);
     // if order >= 2 -> action(left); action(right); action(node);
-    virtual void fmap(std::function<void(FrameSplit*)> onSplit,
-                      std::function<void(FrameLeaf*)> onLeaf, int order) = 0;
-    void fmap(std::function<void(FrameSplit*)> onSplit,
-              std::function<void(FrameLeaf*)> onLeaf) {
-        fmap(onSplit, onLeaf, 0);
-    }
+    // The actions are template parameters such that walking the tree does
+    // not construct any std::function.
+    template <typename OnSplit, typename OnLeaf>
+    void fmap(OnSplit&& onSplit, OnLeaf&& onLeaf, int order = 0);
 
     std::shared_ptr<FrameSplit> getParent() { return parent_.lock(); };
     std::shared_ptr<Frame> root();
@@ -79,14 +76,18 @@ public:
 
     friend class FrameSplit;
     friend class FrameTree;
-    friend class HSTag; // for HSTag::foreachClient()
     DynAttribute_<std::string> frameIndexAttr_;
     std::string frameIndex() const;
 public: // soon will be protected:
     virtual std::shared_ptr<FrameSplit> isSplit() { return std::shared_ptr<FrameSplit>(); };
     virtual std::shared_ptr<FrameLeaf> isLeaf() { return std::shared_ptr<FrameLeaf>(); };
+    //! like isSplit() and isLeaf(), but without touching reference counts
+    virtual FrameSplit* asSplit() { return nullptr; }
+    virtual FrameLeaf* asLeaf() { return nullptr; }
 protected:
-    void foreachClient(ClientAction action);
+    //! call the action for every client in this subtree
+    template <typename ClientAction>
+    void foreachClient(ClientAction&& action);
     HSTag* tag_;
     Settings* settings_;
     std::weak_ptr<FrameSplit> parent_;
@@ -105,11 +106,7 @@ public:
     bool removeClient(Client* client) override;
     void moveClient(int new_index);
 
-    TilingResult computeLayout(Rectangle rect) override;
-
-    virtual void fmap(std::function<void(FrameSplit*)> onSplit,
-                      std::function<void(FrameLeaf*)> onLeaf, int order) override;
-
+    void computeLayout(Rectangle rect, TilingResult& res) override;
 
     // own members
     void setSelection(int index);
@@ -129,6 +126,7 @@ public:
 
     std::shared_ptr<FrameLeaf> thisLeaf();
     std::shared_ptr<FrameLeaf> isLeaf() override { return thisLeaf(); }
+    FrameLeaf* asLeaf() override { return this; }
 
     friend class Frame;
     void setVisible(bool visible);
@@ -138,13 +136,7 @@ public:
     DynAttribute_<LayoutAlgorithm> algorithmAttr_;
 private:
     friend class FrameTree;
-    // layout algorithms
-    TilingResult layoutLinear(Rectangle rect, bool vertical);
-    TilingResult layoutHorizontal(Rectangle rect) { return layoutLinear(rect, false); };
-    TilingResult layoutVertical(Rectangle rect) { return layoutLinear(rect, true); };
-    TilingResult layoutMax(Rectangle rect);
-    TilingResult layoutGrid(Rectangle rect);
-
+    LayoutOptions layoutOptions();
     // members
     FrameDecoration* decoration;
 };
@@ -158,10 +150,7 @@ public:
     std::shared_ptr<FrameLeaf> frameWithClient(Client* client) override;
     bool removeClient(Client* client) override;
 
-    TilingResult computeLayout(Rectangle rect) override;
-
-    virtual void fmap(std::function<void(FrameSplit*)> onSplit,
-                      std::function<void(FrameLeaf*)> onLeaf, int order) override;
+    void computeLayout(Rectangle rect, TilingResult& res) override;
 
     Client* focusedClient() override;
 
@@ -179,6 +168,7 @@ public:
     static FixPrecDec clampFraction(FixPrecDec fraction);
     std::shared_ptr<FrameSplit> thisSplit();
     std::shared_ptr<FrameSplit> isSplit() override { return thisSplit(); }
+    FrameSplit* asSplit() override { return this; }
     SplitAlign getAlign() { return align_; }
     void swapSelection() { selection_ = selection_ == 0 ? 1 : 0; }
     void setSelection(int s) { selection_ = s; }
@@ -188,9 +178,41 @@ public:
     Link_<Frame> aLink_;
     Link_<Frame> bLink_;
 private:
+    friend class Frame;
     friend class FrameTree;
 };
 
+template <typename OnSplit, typename OnLeaf>
+void Frame::fmap(OnSplit&& onSplit, OnLeaf&& onLeaf, int order) {
+    FrameSplit* split = asSplit();
+    if (!split) {
+        onLeaf(asLeaf());
+        return;
+    }
+    if (order <= 0) {
+        onSplit(split);
+    }
+    split->a_->fmap(onSplit, onLeaf, order);
+    if (order == 1) {
+        onSplit(split);
+    }
+    split->b_->fmap(onSplit, onLeaf, order);
+    if (order >= 2) {
+        onSplit(split);
+    }
+}
+
+template <typename ClientAction>
+void Frame::foreachClient(ClientAction&& action) {
+    fmap([] (FrameSplit*) {},
+         [&action] (FrameLeaf* l) {
+            for (Client* client : l->clients) {
+                action(client);
+            }
+         },
+         0);
+}
+
 // functions
 int frame_current_bring(int argc, char** argv, Output output);
 
@@ -0,0 +1,244 @@
+#include "layoutengine.h"
+
+#include "tilingresult.h"
+
+using std::vector;
+
+static const LinearLayout g_layout_vertical(true);
+static const LinearLayout g_layout_horizontal(false);
+static const MaxLayout g_layout_max;
+static const GridLayout g_layout_grid;
+static const MasterStackLayout g_layout_master;
+
+//! the engines in the order of the LayoutAlgorithm values
+static const LayoutEngine* g_layout_engines[] = {
+    &g_layout_vertical,
+    &g_layout_horizontal,
+    &g_layout_max,
+    &g_layout_grid,
+    &g_layout_master,
+};
+static_assert(sizeof(g_layout_engines) / sizeof(g_layout_engines[0])
+              == LAYOUT_ALGORITHM_COUNT,
+              "every LayoutAlgorithm needs an engine");
+
+const LayoutEngine& LayoutEngine::forAlgorithm(LayoutAlgorithm algorithm) {
+    return *g_layout_engines[static_cast<size_t>(algorithm)];
+}
+
+void LinearLayout::apply(const vector<Client*>& clients,
+                         const LayoutClientState& state, int selection,
+                         Rectangle rect, const LayoutOptions& options,
+                         TilingResult& res) const
+{
+    auto cur = rect;
+    int last_step_y;
+    int last_step_x;
+    int step_y;
+    int step_x;
+    int count = clients.size();
+    if (vertical_) {
+        // only do steps in y direction
+        last_step_y = cur.height % count; // get the space on bottom
+        last_step_x = 0;
+        cur.height /= count;
+        step_y = cur.height;
+        step_x = 0;
+    } else {
+        // only do steps in x direction
+        last_step_y = 0;
+        last_step_x = cur.width % count; // get the space on the right
+        cur.width /= count;
+        step_y = 0;
+        step_x = cur.width;
+    }
+    int i = 0;
+    for (auto client : clients) {
+        // add the space, if count does not divide frameheight without remainder
+        cur.height += (i == count-1) ? last_step_y : 0;
+        cur.width += (i == count-1) ? last_step_x : 0;
+        res.add(client, TilingStep(cur));
+        cur.y += step_y;
+        cur.x += step_x;
+        i++;
+    }
+}
+
+int LinearLayout::neighbourIndex(int count, int selection, Direction direction,
+                                 const LayoutOptions& options) const
+{
+    Direction next = vertical_ ? Direction::Down : Direction::Right;
+    Direction previous = vertical_ ? Direction::Up : Direction::Left;
+    if (direction == next) {
+        return selection + 1;
+    }
+    if (direction == previous) {
+        return selection - 1;
+    }
+    return -1;
+}
+
+void MaxLayout::apply(const vector<Client*>& clients,
+                      const LayoutClientState& state, int selection,
+                      Rectangle rect, const LayoutOptions& options,
+                      TilingResult& res) const
+{
+    // go through all clients from top to bottom and remember
+    // whether they are still visible. The stacking order is such that
+    // the windows at the end of 'clients' are on top of the windows
+    // at the beginning of 'clients'. So start at the selection and go
+    // downwards in the stack, i.e. backwards in the 'clients' array
+    bool stillVisible = true;
+    for (size_t idx = 0; idx < clients.size(); idx++) {
+        size_t index = (selection + clients.size() - idx) % clients.size();
+        Client* client = clients[index];
+        TilingStep step(rect);
+        step.visible = stillVisible;
+        // the next is only visible, if the current client is visible
+        // and if the current client is pseudotiled
+        stillVisible = stillVisible && state.pseudotiled(index);
+        if (client == clients[selection]) {
+            step.needsRaise = true;
+        }
+        res.add(client, step);
+    }
+}
+
+int MaxLayout::neighbourIndex(int count, int selection, Direction direction,
+                              const LayoutOptions& options) const
+{
+    return -1;
+}
+
+void GridLayout::gridSize(size_t count, int* res_rows, int* res_cols) {
+    unsigned cols = 0;
+    while (cols * cols < count) {
+        cols++;
+    }
+    *res_cols = cols;
+    if (*res_cols != 0) {
+        *res_rows = (count / cols) + (count % cols ? 1 : 0);
+    } else {
+        *res_rows = 0;
+    }
+}
+
+void GridLayout::apply(const vector<Client*>& clients,
+                       const LayoutClientState& state, int selection,
+                       Rectangle rect, const LayoutOptions& options,
+                       TilingResult& res) const
+{
+    int rows, cols;
+    gridSize(clients.size(), &rows, &cols);
+    int width = rect.width / cols;
+    int height = rect.height / rows;
+    int i = 0;
+    auto cur = rect; // current rectangle
+    for (int r = 0; r < rows; r++) {
+        // reset to left
+        cur.x = rect.x;
+        cur.width = width;
+        cur.height = height;
+        if (r == rows -1) {
+            // fill small pixel gap below last row
+            cur.height += rect.height % rows;
+        }
+        int count = clients.size();
+        for (int c = 0; c < cols && i < count; c++) {
+            if (options.gaplessGrid && (i == count - 1) // if last client
+                && (count % cols != 0)) {           // if cols remain
+                // fill remaining cols with client
+                cur.width = rect.x + rect.width - cur.x;
+            } else if (c == cols - 1) {
+                // fill small pixel gap in last col
+                cur.width += rect.width % cols;
+            }
+
+            // apply size
+            res.add(clients[i], TilingStep(cur));
+            cur.x += width;
+            i++;
+        }
+        cur.y += height;
+    }
+}
+
+int GridLayout::neighbourIndex(int count, int selection, Direction direction,
+                               const LayoutOptions& options) const
+{
+    int rows, cols;
+    gridSize(count, &rows, &cols);
+    if (cols == 0) {
+        return -1;
+    }
+    int r = selection / cols;
+    int c = selection % cols;
+    int index = -1;
+    switch (direction) {
+        case Direction::Down:
+            index = selection + cols;
+            if (options.gaplessGrid && index >= count && r == (rows - 2)) {
+                // if grid is gapless and we're in the second-last row
+                // then it means last client is below us
+                index = count - 1;
+            }
+            break;
+        case Direction::Up: index = selection - cols; break;
+        case Direction::Right:
+            if (c < cols - 1) {
+                index = selection + 1;
+            }
+            break;
+        case Direction::Left:
+            if (c > 0) {
+                index = selection - 1;
+            }
+            break;
+    }
+    return index;
+}
+
+void MasterStackLayout::apply(const vector<Client*>& clients,
+                              const LayoutClientState& state, int selection,
+                              Rectangle rect, const LayoutOptions& options,
+                              TilingResult& res) const
+{
+    if (clients.size() == 1) {
+        res.add(clients[0], TilingStep(rect));
+        return;
+    }
+    auto master = rect;
+    master.width = rect.width * options.masterWidthPercent / 100;
+    res.add(clients[0], TilingStep(master));
+    // the remaining clients are stacked like in the vertical layout
+    auto cur = rect;
+    cur.x += master.width;
+    cur.width -= master.width;
+    int count = clients.size() - 1;
+    int last_step_y = cur.height % count; // get the space on bottom
+    cur.height /= count;
+    for (int i = 1; i <= count; i++) {
+        if (i == count) {
+            cur.height += last_step_y;
+        }
+        res.add(clients[i], TilingStep(cur));
+        cur.y += cur.height;
+    }
+}
+
+int MasterStackLayout::neighbourIndex(int count, int selection,
+                                      Direction direction,
+                                      const LayoutOptions& options) const
+{
+    if (selection == 0) {
+        // the stack is on the right of the master
+        return (direction == Direction::Right && count > 1) ? 1 : -1;
+    }
+    switch (direction) {
+        case Direction::Left: return 0;
+        case Direction::Right: return -1;
+        case Direction::Up: return (selection > 1) ? selection - 1 : -1;
+        case Direction::Down: return selection + 1;
+    }
+    return -1;
+}
@@ -0,0 +1,109 @@
+#ifndef HERBSTLUFT_LAYOUTENGINE_H
+#define HERBSTLUFT_LAYOUTENGINE_H
+
+#include <vector>
+
+#include "framedata.h"
+#include "types.h"
+#include "x11-types.h"
+
+class Client;
+class TilingResult;
+
+//! the settings that influence the layout algorithms
+struct LayoutOptions {
+    bool gaplessGrid = false;
+    //! the width of the master client in percent of the frame width
+    int masterWidthPercent = 50;
+};
+
+/*! The properties of the clients in a frame that the layout engines
+ * look at. The engines never access a Client themselves, so they can be
+ * used with placeholder clients (e.g. in the layout engine benchmark).
+ */
+class LayoutClientState {
+public:
+    virtual ~LayoutClientState() = default;
+    //! whether the client at the given index is pseudotiled
+    virtual bool pseudotiled(size_t index) const = 0;
+};
+
+/*! A layout algorithm arranges the clients of a frame leaf within
+ * the frame's rectangle. Every LayoutAlgorithm has exactly one
+ * LayoutEngine, and FrameLeaf dispatches via forAlgorithm() instead of
+ * distinguishing the algorithms itself.
+ */
+class LayoutEngine {
+public:
+    virtual ~LayoutEngine() = default;
+    //! the engine implementing the given algorithm
+    static const LayoutEngine& forAlgorithm(LayoutAlgorithm algorithm);
+
+    /*! append one tiling step per client to 'res', in the order
+     * of 'clients'. 'selection' is a valid index in 'clients', and
+     * 'clients' is not empty. 'state' describes the clients by their
+     * index in 'clients'.
+     */
+    virtual void apply(const std::vector<Client*>& clients,
+                       const LayoutClientState& state, int selection,
+                       Rectangle rect, const LayoutOptions& options,
+                       TilingResult& res) const = 0;
+
+    /*! the index of the client next to the selected one in the given
+     * direction, or -1 if there is no such client in the frame
+     */
+    virtual int neighbourIndex(int count, int selection, Direction direction,
+                               const LayoutOptions& options) const = 0;
+};
+
+//! all clients next to each other, either from top to bottom or from left
+//! to right
+class LinearLayout : public LayoutEngine {
+public:
+    LinearLayout(bool vertical) : vertical_(vertical) {}
+    void apply(const std::vector<Client*>& clients,
+               const LayoutClientState& state, int selection,
+               Rectangle rect, const LayoutOptions& options,
+               TilingResult& res) const override;
+    int neighbourIndex(int count, int selection, Direction direction,
+                       const LayoutOptions& options) const override;
+private:
+    bool vertical_;
+};
+
+//! all clients maximized on top of each other
+class MaxLayout : public LayoutEngine {
+public:
+    void apply(const std::vector<Client*>& clients,
+               const LayoutClientState& state, int selection,
+               Rectangle rect, const LayoutOptions& options,
+               TilingResult& res) const override;
+    int neighbourIndex(int count, int selection, Direction direction,
+                       const LayoutOptions& options) const override;
+};
+
+//! the clients in rows and columns
+class GridLayout : public LayoutEngine {
+public:
+    void apply(const std::vector<Client*>& clients,
+               const LayoutClientState& state, int selection,
+               Rectangle rect, const LayoutOptions& options,
+               TilingResult& res) const override;
+    int neighbourIndex(int count, int selection, Direction direction,
+                       const LayoutOptions& options) const override;
+    //! the size of the grid for the given number of clients
+    static void gridSize(size_t count, int* rows, int* cols);
+};
+
+//! the first client on the left, the others below each other on the right
+class MasterStackLayout : public LayoutEngine {
+public:
+    void apply(const std::vector<Client*>& clients,
+               const LayoutClientState& state, int selection,
+               Rectangle rect, const LayoutOptions& options,
+               TilingResult& res) const override;
+    int neighbourIndex(int count, int selection, Direction direction,
+                       const LayoutOptions& options) const override;
+};
+
+#endif
@@ -1,11 +1,16 @@
 #include <X11/X.h>
 #include <X11/Xlib.h>
+#include <fcntl.h>
 #include <getopt.h>
+#include <spawn.h>
 #include <sys/wait.h>
 #include <unistd.h>
+#include <cerrno>
 #include <csignal>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
 #include <vector>
 
@@ -15,6 +20,7 @@
 #include "ewmh.h"
 #include "frametree.h"
 #include "globals.h"
+#include "hlwmcommon.h"
 #include "hook.h"
 #include "ipc-protocol.h"
 #include "ipc-server.h"
@@ -28,6 +34,7 @@
 #include "rootcommands.h"
 #include "rulemanager.h"
 #include "settings.h"
+#include "stats.h"
 #include "tagmanager.h"
 #include "tmp.h"
 #include "utils.h"
@@ -40,6 +47,7 @@ using std::pair;
 using std::shared_ptr;
 using std::string;
 using std::unique_ptr;
+using std::vector;
 
 // globals:
 int g_verbose = 0;
@@ -49,6 +57,7 @@ Window      g_root;
 
 // module internals:
 static char*    g_autostart_path = nullptr; // if not set, then find it in $HOME or $XDG_CONFIG_HOME
+static int      g_autostart_commands = 0; // read the autostart file as a list of commands
 static bool     g_exec_before_quit = false;
 static char**   g_exec_args = nullptr;
 static XMainLoop* g_main_loop = nullptr;
@@ -73,6 +82,7 @@ unique_ptr<CommandTable> commands(shared_ptr<Root> root) {
     MouseManager* mouse = root->mouse();
     RuleManager* rules = root->rules();
     Settings* settings = root->settings();
+    Stats* stats = root->stats();
     TagManager* tags = root->tags();
     Tmp* tmp = root->tmp();
 
@@ -87,8 +97,14 @@ unique_ptr<CommandTable> commands(shared_ptr<Root> root) {
                                            &RootCommands::completeCommandShifted1}},
         {"silent",         {root_commands, &RootCommands::silentCommand,
                                            &RootCommands::completeCommandShifted1}},
-        {"reload",         {[] { execute_autostart_file(); return 0; }}},
+        {"reload",         {[] {
+                                PhaseTimer timer(g_display);
+                                execute_autostart_file();
+                                timer.stop(*Root::get()->stats->startup->reload(), g_display);
+                                return 0;
+                            }}},
         {"version",        { version }},
+        {"reset_stats",    {[stats] { return stats->resetCommand(); }}},
         {"list_commands",  { list_commands }},
         {"list_monitors",  {monitors, &MonitorManager::list_monitors }},
         {"set_monitors",   {monitors, &MonitorManager::setMonitorsCommand,
@@ -297,29 +313,93 @@ static void execvp_helper(char *const command[]) {
     perror(" failed");
 }
 
-// spawn() heavily inspired by dwm.c
-int spawn(int argc, char** argv) {
-    if (argc < 2) {
-        return HERBST_NEED_MORE_ARGS;
+#ifdef POSIX_SPAWN_SETSID
+//! start the given command in a new session. In contrast to fork() and
+//! exec(), posix_spawn() does not duplicate the entire address space of the
+//! window manager. If searchPath is set, then a command without a slash is
+//! looked up in $PATH. Returns the error code of posix_spawn()
+static int spawn_helper(char *const command[], bool searchPath) {
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    if (g_display) {
+        // the child must not inherit the connection to the X server
+        posix_spawn_file_actions_addclose(&actions, ConnectionNumber(g_display));
     }
-    if (fork() == 0) {
-        // only look in child
+    posix_spawnattr_t attr;
+    posix_spawnattr_init(&attr);
+    // start the child with no signals blocked
+    sigset_t emptyMask;
+    sigemptyset(&emptyMask);
+    posix_spawnattr_setsigmask(&attr, &emptyMask);
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSID | POSIX_SPAWN_SETSIGMASK);
+    pid_t pid;
+    int status = searchPath
+        ? posix_spawnp(&pid, command[0], &actions, &attr, command, environ)
+        : posix_spawn(&pid, command[0], &actions, &attr, command, environ);
+    posix_spawnattr_destroy(&attr);
+    posix_spawn_file_actions_destroy(&actions);
+    return status;
+}
+#else
+//! start the given command in a new session via fork() and exec(), for
+//! systems whose posix_spawn() can not start a new session
+//! (POSIX_SPAWN_SETSID is a GNU extension). If searchPath is set, then a
+//! command without a slash is looked up in $PATH. Returns the errno of a
+//! failed fork() or exec()
+static int spawn_helper(char *const command[], bool searchPath) {
+    // the child reports a failed exec() through this pipe, which is
+    // closed automatically by a successful exec()
+    int errorPipe[2];
+    if (pipe(errorPipe) != 0) {
+        return errno;
+    }
+    fcntl(errorPipe[1], F_SETFD, FD_CLOEXEC);
+    pid_t pid = fork();
+    if (pid == 0) {
+        // only in the child
+        close(errorPipe[0]);
         if (g_display) {
             close(ConnectionNumber(g_display));
         }
-        // shift all args in argv by 1 to the front
-        // so that we have space for a NULL entry at the end for execvp
-        char** execargs = argv_duplicate(argc, argv);
-        free(execargs[0]);
-        int i;
-        for (i = 0; i < argc-1; i++) {
-            execargs[i] = execargs[i+1];
-        }
-        execargs[i] = nullptr;
-        // do actual exec
+        sigset_t emptyMask;
+        sigemptyset(&emptyMask);
+        sigprocmask(SIG_SETMASK, &emptyMask, nullptr);
         setsid();
-        execvp_helper(execargs);
-        exit(0);
+        if (searchPath) {
+            execvp(command[0], command);
+        } else {
+            execv(command[0], command);
+        }
+        int error = errno;
+        if (write(errorPipe[1], &error, sizeof(error)) < 0) {
+            // the parent only misses the error code
+        }
+        _exit(EXIT_FAILURE);
+    }
+    close(errorPipe[1]);
+    int status = 0;
+    if (pid < 0) {
+        status = errno;
+    } else if (read(errorPipe[0], &status, sizeof(status)) != sizeof(status)) {
+        // the pipe was closed by exec(), so the command is running
+        status = 0;
+    }
+    close(errorPipe[0]);
+    return status;
+}
+#endif
+
+int spawn(int argc, char** argv) {
+    if (argc < 2) {
+        return HERBST_NEED_MORE_ARGS;
+    }
+    // drop argv[0] and add a NULL entry at the end
+    vector<char*> execargs(argv + 1, argv + argc);
+    execargs.push_back(nullptr);
+    int status = spawn_helper(execargs.data(), true);
+    if (status != 0) {
+        std::cerr << "herbstluftwm: execvp \"" << execargs[0] << "\" failed: "
+                  << strerror(status) << endl;
     }
     return 0;
 }
@@ -379,6 +459,87 @@ int jumpto_command(int argc, char** argv, Output output) {
     }
 }
 
+//! split a line of a command file into its arguments. Arguments are
+//! separated by whitespace and may be quoted by ' or ". Outside of single
+//! quotes, a backslash escapes the next character. A # at the beginning of
+//! an argument starts a comment. Returns false on an unterminated quote.
+static bool split_command_line(const string& line, vector<string>& args) {
+    bool inArg = false;
+    char quote = '\0';
+    string arg;
+    for (size_t i = 0; i < line.size(); i++) {
+        char c = line[i];
+        if (quote != '\0' && c == quote) {
+            quote = '\0';
+        } else if (c == '\\' && quote != '\'' && i + 1 < line.size()) {
+            arg += line[++i];
+            inArg = true;
+        } else if (quote != '\0') {
+            arg += c;
+        } else if (c == '\'' || c == '"') {
+            quote = c;
+            inArg = true;
+        } else if (c == ' ' || c == '\t') {
+            if (inArg) {
+                args.push_back(arg);
+                arg.clear();
+                inArg = false;
+            }
+        } else if (c == '#' && !inArg) {
+            break;
+        } else {
+            arg += c;
+            inArg = true;
+        }
+    }
+    if (inArg) {
+        args.push_back(arg);
+    }
+    return quote == '\0';
+}
+
+//! whether the file starts with #!, i.e. is a script for an interpreter
+static bool starts_with_shebang(std::ifstream& file) {
+    char magic[2] = {};
+    file.read(magic, 2);
+    bool shebang = file.gcount() == 2 && magic[0] == '#' && magic[1] == '!';
+    file.clear();
+    file.seekg(0);
+    return shebang;
+}
+
+//! execute the commands in the given file directly, one command per line
+static void execute_command_file(const string& path, std::ifstream& file) {
+    static bool running = false;
+    if (running) {
+        HSWarning("Ignoring recursive execution of %s\n", path.c_str());
+        return;
+    }
+    running = true;
+    string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        vector<string> args;
+        if (!split_command_line(line, args)) {
+            std::cerr << path << ":" << lineNumber
+                      << ": unterminated quote" << endl;
+            continue;
+        }
+        if (args.empty()) {
+            continue;
+        }
+        auto result = HlwmCommon::callCommand(args);
+        if (result.first == 0) {
+            std::cout << result.second;
+        } else if (!result.second.empty()) {
+            std::cerr << path << ":" << lineNumber << ": " << result.second;
+        }
+    }
+    std::cout.flush();
+    running = false;
+}
+
 void execute_autostart_file() {
     string path;
     if (g_autostart_path) {
@@ -399,20 +560,28 @@ void execute_autostart_file() {
         }
         path += "/" HERBSTLUFT_AUTOSTART;
     }
-    if (0 == fork()) {
-        if (g_display) {
-            close(ConnectionNumber(g_display));
+    if (g_autostart_commands) {
+        // a script is still executed, even if it is passed by mistake
+        std::ifstream file(path);
+        if (file && !starts_with_shebang(file)) {
+            execute_command_file(path, file);
+            return;
         }
-        setsid();
-        execl(path.c_str(), path.c_str(), nullptr);
-
-        const char* global_autostart = HERBSTLUFT_GLOBAL_AUTOSTART;
-        HSDebug("Cannot execute %s, falling back to %s\n", path.c_str(), global_autostart);
-        execl(global_autostart, global_autostart, nullptr);
-
-        fprintf(stderr, "herbstluftwm: execvp \"%s\"", global_autostart);
-        perror(" failed");
-        exit(EXIT_FAILURE);
+    }
+    // the autostart file is executed directly, even without a slash in
+    // its path, as it is not a command in $PATH
+    char* command[] = { &path[0], nullptr };
+    if (0 == spawn_helper(command, false)) {
+        return;
+    }
+    const char* global_autostart = HERBSTLUFT_GLOBAL_AUTOSTART;
+    HSDebug("Cannot execute %s, falling back to %s\n", path.c_str(), global_autostart);
+    string globalPath = global_autostart;
+    command[0] = &globalPath[0];
+    int status = spawn_helper(command, false);
+    if (status != 0) {
+        fprintf(stderr, "herbstluftwm: execv \"%s\" failed: %s\n",
+                global_autostart, strerror(status));
     }
 }
 
@@ -426,6 +595,7 @@ static void parse_arguments(int argc, char** argv, Globals& g) {
         {"exit-on-xerror",  0, &exit_on_xerror, 1},
         {"no-tag-import",   0, &no_tag_import, 1},
         {"verbose",         0, &g_verbose, 1},
+        {"autostart-commands", 0, &g_autostart_commands, 1},
         {}
     };
     // parse options
@@ -486,6 +656,7 @@ int main(int argc, char* argv[]) {
     Globals g;
     parse_arguments(argc, argv, g);
     XConnection::setExitOnError(g.exitOnXlibError);
+    PhaseTimer connectTimer(nullptr);
     XConnection* X = XConnection::connect();
     g_display = X->display();
     if (!g_display) {
@@ -508,7 +679,11 @@ int main(int argc, char* argv[]) {
     g_root = X->root();
     XSelectInput(X->display(), X->root(), SubstructureRedirectMask|SubstructureNotifyMask|ButtonPressMask|EnterWindowMask|LeaveWindowMask|StructureNotifyMask);
 
+    PhaseStats connectStats;
+    connectTimer.stop(connectStats, X->display());
+
     // setup ipc server
+    PhaseTimer setupTimer(X->display());
     IpcServer* ipcServer = new IpcServer(*X);
 
     auto root = make_shared<Root>(g, *X, *ipcServer);
@@ -519,8 +694,13 @@ int main(int argc, char* argv[]) {
 
     XMainLoop mainloop(*X, root.get());
     g_main_loop = &mainloop;
+    auto& startupStats = *root->stats->startup();
+    startupStats.connect->duration_ = connectStats.duration_();
+    startupStats.connect->requests_ = connectStats.requests_();
+    setupTimer.stop(*startupStats.setup(), X->display());
 
     // setup
+    PhaseTimer monitorsTimer(X->display());
     if (g.importTagsFromEwmh) {
         const auto& initialState = root->ewmh->initialState();
         for (auto n : initialState.desktopNames) {
@@ -528,11 +708,16 @@ int main(int argc, char* argv[]) {
         }
     }
     root->monitors()->ensure_monitors_are_available();
+    monitorsTimer.stop(*startupStats.monitors(), X->display());
+    PhaseTimer scanTimer(X->display());
     mainloop.scanExistingClients();
     tag_force_update_flags();
     all_monitors_apply_layout();
     root->ewmh->updateAll();
+    scanTimer.stop(*startupStats.scan(), X->display());
+    PhaseTimer autostartTimer(X->display());
     execute_autostart_file();
+    autostartTimer.stop(*startupStats.autostart(), X->display());
 
     // main loop
     mainloop.run();
@@ -150,7 +150,11 @@ void Monitor::applyLayout() {
         cur_rect.width -= settings->frame_gap();
     }
     bool isFocused = get_current_monitor() == this;
-    TilingResult res = tag->frame->root_->computeLayout(cur_rect);
+    // take over the buffer of the previous layout such that its capacity
+    // is reused. (A nested applyLayout() just starts with an empty buffer)
+    TilingResult res = std::move(layoutBuffer_);
+    res.clear();
+    tag->frame->root_->computeLayout(cur_rect, res);
     if (tag->floating_focused) {
         res.focus = tag->focusedClient();
     }
@@ -263,6 +267,7 @@ void Monitor::applyLayout() {
     // remove all enternotify-events from the event queue that were
     // generated while arranging the clients on this monitor
     monman->dropEnterNotifyEvents.emit();
+    layoutBuffer_ = std::move(res);
 }
 
 Monitor* find_monitor_by_name(const char* name) {
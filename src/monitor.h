@@ -6,6 +6,7 @@
 #include "attribute_.h"
 #include "object.h"
 #include "rules.h"
+#include "tilingresult.h"
 #include "x11-types.h"
 
 class HSTag;
@@ -62,6 +63,8 @@ private:
     std::string setTagString(std::string new_tag);
     Settings* settings;
     MonitorManager* monman;
+    //! the result of the last applyLayout(), kept for its capacity
+    TilingResult layoutBuffer_;
 };
 
 // adds a new monitor to the monitors list and returns a pointer to it
@@ -4,6 +4,7 @@
 #include <cassert>
 #include <memory>
 
+#include "client.h"
 #include "command.h"
 #include "completion.h"
 #include "ewmh.h"
@@ -30,6 +31,7 @@ using std::make_shared;
 using std::pair;
 using std::shared_ptr;
 using std::string;
+using std::stringstream;
 using std::to_string;
 using std::vector;
 
@@ -518,6 +520,19 @@ private:
     string label_;
 };
 
+//! the label of a slice in the output of the stack command
+static string sliceLabel(Slice* slice) {
+    stringstream label;
+    Client* client = slice->client();
+    if (client) {
+        label << "Client " << WindowID(client->x11Window()).str()
+              << " \"" << client->title_() << "\"";
+    } else {
+        label << "Window " << WindowID(slice->window()).str();
+    }
+    return label.str();
+}
+
 int MonitorManager::stackCommand(Output output) {
     vector<shared_ptr<StringTree>> monitors;
     for (Monitor* monitor : monitorStack_) {
@@ -527,7 +542,7 @@ int MonitorManager::stackCommand(Output output) {
 
             vector<shared_ptr<StringTree>> slices;
             for (auto& slice : layer) {
-                slices.push_back(make_shared<StringTree>(slice->getLabel()));
+                slices.push_back(make_shared<StringTree>(sliceLabel(slice)));
             }
 
             auto layerLabel = g_layer_names[layerIdx];
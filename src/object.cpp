@@ -64,7 +64,7 @@ void Object::ls(Output out)
 {
     out << children_.size() << (children_.size() == 1 ? " child" : " children")
         << (!children_.empty() ? ":" : ".") << endl;
-    for (auto it : children_) {
+    for (const auto& it : children_) {
         out << "  " << it.first << "." << endl;
     }
 
@@ -75,7 +75,7 @@ void Object::ls(Output out)
         << " | .-- writeable\n"
         << " | | .-- hookable\n"
         << " V V V" << endl;
-    for (auto it : attribs_) {
+    for (const auto& it : attribs_) {
         out << " " << it.second->typechar();
         out << " " << (it.second->writeable() ? "w" : "-");
         out << " " << (it.second->hookable() ? "h" : "-");
@@ -91,7 +91,7 @@ void Object::ls(Output out)
 
     out << actions_.size() << (actions_.size() == 1 ? " action" : " actions")
         << (!actions_.empty() ? ":" : ".") << endl;
-    for (auto it : actions_) {
+    for (const auto& it : actions_) {
         out << "  " << it.first << endl;
     }
 }
@@ -113,14 +113,14 @@ void Object::print(const string &prefix)
 {
     if (!children_.empty()) {
         std::cout << prefix << "Children:" << endl;
-        for (auto it : children_) {
+        for (const auto& it : children_) {
             it.second->print(prefix + "\t| ");
         }
         std::cout << prefix << endl;
     }
     if (!attribs_.empty()) {
         std::cout << prefix << "Attributes:" << endl;
-        for (auto it : attribs_) {
+        for (const auto& it : attribs_) {
             std::cout << prefix << "\t" << it.first
                       << " (" << it.second->typestr() << ")";
             std::cout << "\t[" << it.second->str() << "]";
@@ -136,7 +136,7 @@ void Object::print(const string &prefix)
     if (!actions_.empty()) {
         std::cout << prefix << "Actions:" << endl;
         std::cout << prefix;
-        for (auto it : actions_) {
+        for (const auto& it : actions_) {
             std::cout << "\t" << it.first;
         }
         std::cout << endl;
@@ -242,16 +242,19 @@ void Object::removeHook(Hook* hook)
 
 class DirectoryTreeInterface : public TreeInterface {
 public:
-    DirectoryTreeInterface(string label, Object* d) : lbl(label), dir(d) {
-        for (auto child : dir->children()) {
-            buf.push_back(child);
+    DirectoryTreeInterface(const string& label, Object* d) : lbl(label), dir(d) {
+        // only remember the map entries, such that the names and the
+        // children's maps are not copied
+        buf.reserve(dir->children().size());
+        for (auto it = dir->children().begin(); it != dir->children().end(); it++) {
+            buf.push_back(it);
         }
     };
     size_t childCount() override {
         return buf.size();
     };
     shared_ptr<TreeInterface> nthChild(size_t idx) override {
-        return make_shared<DirectoryTreeInterface>(buf[idx].first, buf[idx].second);
+        return make_shared<DirectoryTreeInterface>(buf[idx]->first, buf[idx]->second);
     };
     void appendCaption(Output output) override {
         if (!lbl.empty()) {
@@ -260,7 +263,7 @@ public:
     };
 private:
     string lbl;
-    vector<pair<string,Object*>> buf;
+    vector<std::map<string, Object*>::const_iterator> buf;
     Object* dir;
 };
 
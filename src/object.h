@@ -45,7 +45,7 @@ public:
 
     void addAttribute(Attribute* a);
     void removeAttribute(Attribute* a);
-    std::map<std::string, Attribute*> attributes() { return attribs_; }
+    const std::map<std::string, Attribute*>& attributes() const { return attribs_; }
 
     // if a concrete object maintains its index within the parent as an
     // attribute (e.g. monitors and tags do), then they should implement the
@@ -68,7 +68,8 @@ public:
     void addHook(Hook* hook);
     void removeHook(Hook* hook);
 
-    const std::map<std::string, Object*>& children() { return children_; }
+    const std::map<std::string, Object*>& children() const { return children_; }
+    const std::map<std::string, Action*>& actions() const { return actions_; }
 
     void printTree(Output output, std::string rootLabel);
 
@@ -0,0 +1,55 @@
+#include "recordingbackend.h"
+
+#include <sstream>
+
+using std::pair;
+using std::string;
+using std::stringstream;
+using std::vector;
+
+static string geometryString(Rectangle geometry) {
+    stringstream str;
+    str << geometry.x << " " << geometry.y << " "
+        << geometry.width << " " << geometry.height;
+    return str.str();
+}
+
+pair<string, string> RecordingBackend::windowClass(Window window) {
+    requests.push_back("class " + WindowID(window).str());
+    auto it = windowClasses.find(window);
+    if (it == windowClasses.end()) {
+        return {};
+    }
+    return it->second;
+}
+
+void RecordingBackend::restackWindows(const vector<Window>& windows) {
+    string request = "restack";
+    for (auto window : windows) {
+        request += " " + WindowID(window).str();
+    }
+    requests.push_back(request);
+}
+
+void RecordingBackend::moveResizeWindow(Window window, Rectangle geometry) {
+    requests.push_back("moveresize " + WindowID(window).str()
+                       + " " + geometryString(geometry));
+}
+
+void RecordingBackend::configureClientWindow(Window window, Rectangle geometry) {
+    requests.push_back("configure " + WindowID(window).str()
+                       + " " + geometryString(geometry));
+}
+
+void RecordingBackend::setWindowBackground(Window window, Pixmap pixmap) {
+    requests.push_back("background " + WindowID(window).str()
+                       + " " + WindowID(pixmap).str());
+}
+
+void RecordingBackend::clearWindow(Window window) {
+    requests.push_back("clear " + WindowID(window).str());
+}
+
+void RecordingBackend::sync() {
+    requests.push_back("sync");
+}
@@ -0,0 +1,31 @@
+#ifndef HERBSTLUFT_RECORDINGBACKEND_H
+#define HERBSTLUFT_RECORDINGBACKEND_H
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "displaybackend.h"
+
+/*! A DisplayBackend without a display server. It records every request as
+ * a line of text, e.g. "restack 0x2 0x1", and answers queries from the
+ * values that were set beforehand.
+ */
+class RecordingBackend : public DisplayBackend {
+public:
+    std::pair<std::string, std::string> windowClass(Window window) override;
+    void restackWindows(const std::vector<Window>& windows) override;
+    void moveResizeWindow(Window window, Rectangle geometry) override;
+    void configureClientWindow(Window window, Rectangle geometry) override;
+    void setWindowBackground(Window window, Pixmap pixmap) override;
+    void clearWindow(Window window) override;
+    void sync() override;
+
+    //! the WM_CLASS (instance and class name) returned by windowClass()
+    std::map<Window, std::pair<std::string, std::string>> windowClasses;
+    //! the requests in the order they were sent
+    std::vector<std::string> requests;
+};
+
+#endif
@@ -1,5 +1,6 @@
 #include "regexstr.h"
 
+using std::set;
 using std::string;
 
 RegexStr::RegexStr()
@@ -38,6 +39,33 @@ bool RegexStr::matches(const string& str) const
     }
 }
 
+bool RegexStr::literalAlternatives(const string& source, set<string>& literals)
+{
+    static const string specialChars = ".[]()*+?{}^$\\";
+    literals.clear();
+    string current;
+    for (char ch : source) {
+        if (ch == '|') {
+            if (current.empty()) {
+                // empty alternatives are undefined in extended regexes
+                return false;
+            }
+            literals.insert(current);
+            current.clear();
+        } else if (specialChars.find(ch) != string::npos) {
+            // a special character
+            return false;
+        } else {
+            current += ch;
+        }
+    }
+    if (current.empty()) {
+        return false;
+    }
+    literals.insert(current);
+    return true;
+}
+
 template<> RegexStr Converter<RegexStr>::parse(const string& source) {
     return RegexStr::fromStr(source);
 }
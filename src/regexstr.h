@@ -2,6 +2,7 @@
 #define REGEXSTR_H
 
 #include <regex>
+#include <set>
 
 #include "attribute_.h"
 #include "types.h"
@@ -29,6 +30,13 @@ public:
     bool operator==(const RegexStr& other) const;
     bool operator!=(const RegexStr& o) const { return ! operator==(o); }
     bool matches(const std::string& str) const;
+    /** Check whether the extended regex 'source' consists only of literal
+     * alternatives, e.g. "foo" or "foo|bar|baz", and if so, put these into
+     * 'literals'. Such a regex matches a string if and only if the string
+     * is one of the literals.
+     */
+    static bool literalAlternatives(const std::string& source,
+                                    std::set<std::string>& literals);
 private:
     std::string source_;
     std::regex regex_;
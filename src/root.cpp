@@ -15,11 +15,13 @@
 #include "rootcommands.h"
 #include "rulemanager.h"
 #include "settings.h"
+#include "stats.h"
 #include "tag.h"
 #include "tagmanager.h"
 #include "theme.h"
 #include "tmp.h"
 #include "utils.h"
+#include "xbackend.h"
 
 using std::shared_ptr;
 
@@ -33,6 +35,7 @@ Root::Root(Globals g, XConnection& xconnection, IpcServer& ipcServer)
     , mouse(*this, "mouse")
     , rules(*this, "rules")
     , settings(*this, "settings")
+    , stats(*this, "stats")
     , tags(*this, "tags")
     , theme(*this, "theme")
     , tmp(*this, TMP_OBJECT_PATH)
@@ -42,6 +45,7 @@ Root::Root(Globals g, XConnection& xconnection, IpcServer& ipcServer)
     , ipcServer_(ipcServer)
     , panels(make_unique<PanelManager>(xconnection))
     , ewmh(make_unique<Ewmh>(xconnection))
+    , backend(make_unique<XBackend>(xconnection))
 {
     // initialize root children (alphabetically)
     clients.init();
@@ -51,6 +55,7 @@ Root::Root(Globals g, XConnection& xconnection, IpcServer& ipcServer)
     mouse.init();
     rules.init();
     settings.init();
+    stats.init();
     tags.init();
     theme.init();
     tmp.init();
@@ -58,8 +63,8 @@ Root::Root(Globals g, XConnection& xconnection, IpcServer& ipcServer)
     // inject dependencies where needed
     ewmh->injectDependencies(this);
     settings->injectDependencies(this);
-    tags->injectDependencies(monitors(), settings());
-    clients->injectDependencies(settings(), theme(), ewmh.get());
+    tags->injectDependencies(monitors(), settings(), backend.get());
+    clients->injectDependencies(settings(), theme(), ewmh.get(), backend.get());
     monitors->injectDependencies(settings(), tags(), panels.get());
     mouse->injectDependencies(clients(), monitors());
     panels->injectDependencies(settings());
@@ -95,6 +100,7 @@ Root::~Root()
     keys.reset();
     rules.reset();
     settings.reset();
+    stats.reset();
     theme.reset();
     tmp.reset();
 
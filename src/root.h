@@ -9,6 +9,7 @@
 // new object tree root.
 
 class ClientManager; // IWYU pragma: keep
+class DisplayBackend;
 class Ewmh;
 class FrameLeaf;
 class HlwmCommon;
@@ -21,6 +22,7 @@ class PanelManager;
 class RootCommands;
 class RuleManager; // IWYU pragma: keep
 class Settings; // IWYU pragma: keep
+class Stats; // IWYU pragma: keep
 class TagManager; // IWYU pragma: keep
 class Theme; // IWYU pragma: keep
 class Tmp; // IWYU pragma: keep
@@ -54,6 +56,7 @@ public:
     Child_<MouseManager> mouse;
     Child_<RuleManager> rules;
     Child_<Settings> settings;
+    Child_<Stats> stats;
     Child_<TagManager> tags;
     Child_<Theme> theme;
     Child_<Tmp> tmp;
@@ -66,6 +69,7 @@ public:
     // automatically from the signals emitted by ClientManager, etc
     std::unique_ptr<PanelManager> panels; // Using "pimpl" to avoid include
     std::unique_ptr<Ewmh> ewmh; // Using "pimpl" to avoid include
+    std::unique_ptr<DisplayBackend> backend; // Using "pimpl" to avoid include
 
     // global actions
     void focusFrame(std::shared_ptr<FrameLeaf> frameToFocus);
@@ -506,18 +506,24 @@ template <> int do_comparison<unsigned long>(const unsigned long& a, const unsig
     }
 }
 
-template <typename T> int parse_and_compare(string a, string b, Output o) {
-    vector<T> vals;
-    for (auto &x : {a, b}) {
-        try {
-            vals.push_back(Converter<T>::parse(x));
-        } catch(std::exception& e) {
-            o << "cannot parse \"" << x << "\" to "
-              << typeid(T).name() << ": " << e.what() << endl;
-            return (int) HERBST_INVALID_ARGUMENT;
-        }
+//! compare the value of the attribute (which must be of type T) with
+//! the parsed string b
+template <typename T> int parse_and_compare(Attribute* a, string b, Output o) {
+    TypedAttribute<T>* typedAttr = a->typed<T>();
+    if (!typedAttr) {
+        o << "attribute " << a->name() << " is not of type "
+          << typeid(T).name() << endl;
+        return (int) HERBST_INVALID_ARGUMENT;
+    }
+    T value;
+    try {
+        value = Converter<T>::parse(b);
+    } catch(std::exception& e) {
+        o << "cannot parse \"" << b << "\" to "
+          << typeid(T).name() << ": " << e.what() << endl;
+        return (int) HERBST_INVALID_ARGUMENT;
     }
-    return do_comparison<T>(vals[0], vals[1]);
+    return do_comparison<T>(typedAttr->value(), value);
 }
 
 static std::map<string, pair<bool, vector<int> > > operators {
@@ -545,10 +551,10 @@ int RootCommands::compare_cmd(Input input, Output output)
     //    1 if the first value is greater
     //    0 if the the values match
     //    HERBST_INVALID_ARGUMENT if there was a parsing error
-    std::map<Type, pair<bool, function<int(string,string,Output)>>> type2compare {
+    std::map<Type, pair<bool, function<int(Attribute*,string,Output)>>> type2compare {
         // map a type name to "is it numeric" and a comperator function
         { Type::ATTRIBUTE_INT,      { true,  parse_and_compare<int> }, },
-        { Type::ATTRIBUTE_ULONG,    { true,  parse_and_compare<int> }, },
+        { Type::ATTRIBUTE_ULONG,    { true,  parse_and_compare<unsigned long> }, },
         { Type::ATTRIBUTE_STRING,   { false, parse_and_compare<string> }, },
         { Type::ATTRIBUTE_BOOL,     { false, parse_and_compare<bool> }, },
         { Type::ATTRIBUTE_COLOR,    { false, parse_and_compare<Color> }, },
@@ -579,7 +585,7 @@ int RootCommands::compare_cmd(Input input, Output output)
             << Entity::typestr(a->type()) << endl;
         return HERBST_INVALID_ARGUMENT;
     }
-    int comparison_result = it->second.second(a->str(), value, output);
+    int comparison_result = it->second.second(a, value, output);
     if (comparison_result > 1) {
         return comparison_result;
     }
@@ -618,14 +624,14 @@ void RootCommands::completeObjectPath(Completion& complete, bool attributes,
         return;
     }
     if (attributes) {
-        for (auto& it : object->attributes()) {
+        for (const auto& it : object->attributes()) {
             if (attributeFilter && !attributeFilter(it.second)) {
                 continue;
             }
             complete.full(objectPath + it.first);
         }
     }
-    for (auto& it : object->children()) {
+    for (const auto& it : object->children()) {
         complete.partial(objectPath + it.first + OBJECT_PATH_SEPARATOR);
     }
 }
@@ -805,7 +811,6 @@ void RootCommands::completeEnvName(Completion& complete) {
 
 int RootCommands::chainCommand(Input input, Output output)
 {
-    vector<vector<string>> commands = splitCommandList(input.toVector());
     int returnCode = 0;
     // the condition that has to be fulfilled if we want to continue
     // execuding commands. the default (for 'chain') is to always continue
@@ -819,16 +824,26 @@ int RootCommands::chainCommand(Input input, Output output)
         // continue executing commands while they are failing
         conditionContinue = [](int code) { return code >= 1; };
     }
-    for (auto& cmd : commands) {
-        if (cmd.empty()) {
-            // if command range is empty, do nothing
-            continue;
+    string separator;
+    if (!(input >> separator)) {
+        return returnCode;
+    }
+    // call the commands between the separators directly on the
+    // argument vector of the input, without copying them
+    auto cmdBegin = input.begin();
+    while (true) {
+        auto cmdEnd = std::find(cmdBegin, input.end(), separator);
+        // if command range is empty, do nothing
+        if (cmdBegin != cmdEnd) {
+            returnCode = Commands::call(input.fromRange(cmdBegin, cmdEnd), output);
+            if (!conditionContinue(returnCode)) {
+                break;
+            }
         }
-        Input cmdinput = Input(cmd[0], cmd.begin() + 1, cmd.end());
-        returnCode = Commands::call(cmdinput, output);
-        if (!conditionContinue(returnCode)) {
+        if (cmdEnd == input.end()) {
             break;
         }
+        cmdBegin = cmdEnd + 1;
     }
     return returnCode;
 }
@@ -850,24 +865,3 @@ void RootCommands::chainCompletion(Completion& complete)
         complete.completeCommands(lastsep + 1);
     }
 }
-
-
-vector<vector<string>> RootCommands::splitCommandList(ArgList::Container input) {
-    vector<vector<string>> res;
-    if (input.empty()) {
-        return res;
-    }
-    vector<string> current;
-    string separator = input[0];
-    for (size_t i = 1; i < input.size(); i++) {
-        if (input[i] == separator) {
-            res.push_back(current);
-            current = {};
-        } else {
-            current.push_back(input[i]);
-        }
-    }
-    res.push_back(current);
-    return res;
-}
-
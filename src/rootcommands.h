@@ -77,7 +77,6 @@ public:
     int chainCommand(Input input, Output output);
     void chainCompletion(Completion& complete);
 
-    std::vector<std::vector<std::string>> splitCommandList(ArgList::Container input);
 private:
     Object& root;
     std::vector<std::unique_ptr<Attribute>> userAttributes_;
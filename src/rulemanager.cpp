@@ -214,6 +214,8 @@ void RuleManager::addRuleCompletion(Completion& complete) {
 
 //! Evaluate rules against a given client
 ClientChanges RuleManager::evaluateRules(Client* client, ClientChanges changes) {
+    // the client's properties are only fetched once for all rules
+    MatchContext context(client);
     auto ruleIter = rules_.begin();
     while (ruleIter != rules_.end()) {
         auto& rule = *ruleIter;
@@ -221,27 +223,33 @@ ClientChanges RuleManager::evaluateRules(Client* client, ClientChanges changes)
         bool rule_match = true; // if entire rule matches
         bool rule_expired = false;
 
-        // check all conditions
-        for (auto& cond : rule->conditions) {
-            if (!rule_match && cond.name != "maxage") {
-                // implement lazy AND &&
-                // ... except for maxage
-                continue;
-            }
+        // check all conditions. Regex conditions are the most expensive
+        // ones, so they are only checked once all other conditions matched
+        for (bool regexConditions : { false, true }) {
+            for (auto& cond : rule->conditions) {
+                if ((cond.value_type == CONDITION_VALUE_TYPE_REGEX) != regexConditions) {
+                    continue;
+                }
+                if (!rule_match && cond.name != "maxage") {
+                    // implement lazy AND &&
+                    // ... except for maxage
+                    continue;
+                }
 
-            matches = Condition::matchers.at(cond.name)(&cond, client);
+                matches = Condition::matchers.at(cond.name)(&cond, context);
 
-            if (!matches && !cond.negated
-                && cond.name == "maxage") {
-                // if if not negated maxage does not match anymore
-                // then it will never match again in the future
-                rule_expired = true;
-            }
+                if (!matches && !cond.negated
+                    && cond.name == "maxage") {
+                    // if if not negated maxage does not match anymore
+                    // then it will never match again in the future
+                    rule_expired = true;
+                }
 
-            if (cond.negated) {
-                matches = ! matches;
+                if (cond.negated) {
+                    matches = ! matches;
+                }
+                rule_match = rule_match && matches;
             }
-            rule_match = rule_match && matches;
         }
 
         if (rule_match) {
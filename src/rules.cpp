@@ -80,6 +80,7 @@ bool Rule::addCondition(string name, char op, const char* value, bool negated, O
                 return false;
             }
             cond.value_reg_str = value;
+            cond.value_reg_literal = RegexStr::literalAlternatives(value, cond.value_reg_literals);
             break;
         }
 
@@ -182,9 +183,13 @@ bool Condition::matches(const string& str) const {
         case CONDITION_VALUE_TYPE_STRING:
             return value_str == str;
             break;
-        case CONDITION_VALUE_TYPE_REGEX:
+        case CONDITION_VALUE_TYPE_REGEX: {
+            if (value_reg_literal) {
+                return value_reg_literals.count(str) > 0;
+            }
             return std::regex_match(str, value_reg_exp);
             break;
+        }
         case CONDITION_VALUE_TYPE_INTEGER:
             try {
                 return std::stoi(str) == value_integer;
@@ -196,19 +201,20 @@ bool Condition::matches(const string& str) const {
     return false;
 }
 
-bool Condition::matchesClass(const Client* client) const {
-    return matches(Root::get()->X.getClass(client->window_));
+bool Condition::matchesClass(MatchContext& context) const {
+    return matches(context.windowClass());
 }
 
-bool Condition::matchesInstance(const Client* client) const {
-    return matches(Root::get()->X.getInstance(client->window_));
+bool Condition::matchesInstance(MatchContext& context) const {
+    return matches(context.windowInstance());
 }
 
-bool Condition::matchesTitle(const Client* client) const {
-    return matches(client->title_());
+bool Condition::matchesTitle(MatchContext& context) const {
+    return matches(context.client()->title_());
 }
 
-bool Condition::matchesPid(const Client* client) const {
+bool Condition::matchesPid(MatchContext& context) const {
+    const Client* client = context.client();
     if (client->pid_() < 0) {
         return false;
     }
@@ -221,7 +227,8 @@ bool Condition::matchesPid(const Client* client) const {
     }
 }
 
-bool Condition::matchesPgid(const Client* client) const {
+bool Condition::matchesPgid(MatchContext& context) const {
+    const Client* client = context.client();
     if (client->pgid_() < 0) {
         return false;
     }
@@ -234,31 +241,56 @@ bool Condition::matchesPgid(const Client* client) const {
     }
 }
 
-bool Condition::matchesMaxage(const Client* client) const {
+bool Condition::matchesMaxage(MatchContext&) const {
     time_t diff = get_monotonic_timestamp() - conditionCreationTime;
     return (value_integer >= diff);
 }
 
-bool Condition::matchesWindowtype(const Client* client) const {
-    auto& ewmh = Ewmh::get();
-    int wintype = ewmh.getWindowType(client->x11Window());
-    if (wintype < 0) {
+bool Condition::matchesWindowtype(MatchContext& context) const {
+    auto& wintype = context.windowType();
+    if (!wintype.has_value()) {
         return false;
     }
-    return matches(ewmh.netatomName(wintype));
+    return matches(wintype.value());
 }
 
-bool Condition::matchesWindowrole(const Client* client) const {
-    auto& X = Root::get()->X;
-    auto role = X.getWindowProperty(client->window_, X.atom("WM_WINDOW_ROLE"));
-
+bool Condition::matchesWindowrole(MatchContext& context) const {
+    auto& role = context.windowRole();
     if (!role.has_value()) {
         return false;
     }
-
     return matches(role.value());
 }
 
+/// MATCH CONTEXT ///
+MatchContext::MatchContext(const Client* client)
+    : client_(client)
+{
+}
+
+const string& MatchContext::windowClass() {
+    return client_->windowClass();
+}
+
+const string& MatchContext::windowInstance() {
+    return client_->windowInstance();
+}
+
+const std::experimental::optional<string>& MatchContext::windowType() {
+    if (!windowTypeFetched_) {
+        int wintype = client_->windowType();
+        if (wintype >= 0) {
+            windowType_ = string(Ewmh::get().netatomName(wintype));
+        }
+        windowTypeFetched_ = true;
+    }
+    return windowType_;
+}
+
+const std::experimental::optional<string>& MatchContext::windowRole() {
+    return client_->windowRole();
+}
+
 /// CONSEQUENCES ///
 void Consequence::applyTag(const Client* client, ClientChanges* changes) const {
     changes->tag_name = value;
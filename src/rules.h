@@ -2,7 +2,9 @@
 #define __HS_RULES_H_
 
 #include <functional>
+#include <map>
 #include <regex>
+#include <set>
 
 #include "optional.h"
 #include "regexstr.h"
@@ -10,6 +12,28 @@
 
 class Client;
 
+/** The properties of a client that the conditions of rules are matched
+ * against. Properties that need to be queried from the X server are taken
+ * from the client's property cache and then shared by all conditions of all
+ * rules.
+ */
+class MatchContext {
+public:
+    MatchContext(const Client* client);
+    const Client* client() const { return client_; }
+
+    const std::string& windowClass();
+    const std::string& windowInstance();
+    //! the name of the ewmh window type, if any
+    const std::experimental::optional<std::string>& windowType();
+    const std::experimental::optional<std::string>& windowRole();
+
+private:
+    const Client* client_;
+    bool windowTypeFetched_ = false;
+    std::experimental::optional<std::string> windowType_;
+};
+
 enum {
     CONDITION_VALUE_TYPE_STRING,
     CONDITION_VALUE_TYPE_REGEX,
@@ -23,7 +47,7 @@ enum {
 class Condition {
 public:
 
-    using Matcher = std::function<bool(const Condition*, const Client*)>;
+    using Matcher = std::function<bool(const Condition*, MatchContext&)>;
     static const std::map<std::string, Matcher> matchers;
 
     std::string name;
@@ -34,6 +58,12 @@ public:
     int value_integer = 0;
     std::regex value_reg_exp;
     std::string value_reg_str;
+    /*! If the regex only matches the strings it consists of, e.g. "foo" or
+     * "foo|bar", then value_reg_literal is set and the condition is checked
+     * by a lookup in value_reg_literals instead of running std::regex.
+     */
+    bool value_reg_literal = false;
+    std::set<std::string> value_reg_literals;
 
     /*! Timestamp of when this condition (i.e. rule) was created, which is
      * needed for the maxage matcher.
@@ -45,14 +75,14 @@ public:
     time_t conditionCreationTime = 0;
 
 private:
-    bool matchesClass(const Client* client) const;
-    bool matchesInstance(const Client* client) const;
-    bool matchesTitle(const Client* client) const;
-    bool matchesPid(const Client* client) const;
-    bool matchesPgid(const Client* client) const;
-    bool matchesMaxage(const Client* client) const;
-    bool matchesWindowtype(const Client* client) const;
-    bool matchesWindowrole(const Client* client) const;
+    bool matchesClass(MatchContext& context) const;
+    bool matchesInstance(MatchContext& context) const;
+    bool matchesTitle(MatchContext& context) const;
+    bool matchesPid(MatchContext& context) const;
+    bool matchesPgid(MatchContext& context) const;
+    bool matchesMaxage(MatchContext& context) const;
+    bool matchesWindowtype(MatchContext& context) const;
+    bool matchesWindowrole(MatchContext& context) const;
 
     bool matches(const std::string& string) const;
 };
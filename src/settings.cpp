@@ -70,6 +70,7 @@ Settings::Settings()
         &raise_on_focus_temporarily,
         &raise_on_click,
         &gapless_grid,
+        &master_width_percent,
         &hide_covered_windows,
         &smart_frame_surroundings,
         &smart_window_surroundings,
@@ -116,6 +117,7 @@ Settings::Settings()
          &raise_on_focus_temporarily}) {
         i->changed().connect(&all_monitors_apply_layout);
     }
+    master_width_percent.changed().connect(&all_monitors_apply_layout);
     wmname.changed().connect([]() { Ewmh::get().updateWmName(); });
 
     default_frame_layout.setValidator([] (size_t layout) {
@@ -125,6 +127,12 @@ Settings::Settings()
         }
         return string();
     });
+    master_width_percent.setValidator([] (int percent) {
+        if (percent < 1 || percent > 99) {
+            return string("master_width_percent must be between 1 and 99");
+        }
+        return string();
+    });
     tree_style.setValidator([] (string new_value) {
         if (utf8_string_length(new_value) < 8) {
             return string("tree_style needs 8 characters");
@@ -132,7 +140,7 @@ Settings::Settings()
         return string();
     });
     g_settings = this;
-    for (auto i : attributes()) {
+    for (const auto& i : attributes()) {
         i.second->setWriteable();
     }
 }
@@ -226,7 +234,7 @@ int Settings::set_cmd(Input input, Output output) {
 
 void Settings::set_complete(Completion& complete) {
     if (complete == 0) {
-        for (auto& a : attributes()) {
+        for (const auto& a : attributes()) {
             complete.full(a.first);
         }
     } else if (complete == 1) {
@@ -263,7 +271,7 @@ int Settings::toggle_cmd(Input argv, Output output) {
 
 void Settings::toggle_complete(Completion& complete) {
     if (complete == 0) {
-        for (auto a : attributes()) {
+        for (const auto& a : attributes()) {
             if (a.second->type() == Type::ATTRIBUTE_BOOL) {
                 complete.full(a.first);
             }
@@ -301,7 +309,7 @@ int Settings::cycle_value_cmd(Input argv, Output output) {
 
 void Settings::cycle_value_complete(Completion& complete) {
     if (complete == 0) {
-        for (auto a : attributes()) {
+        for (const auto& a : attributes()) {
             complete.full(a.first);
         }
     } else {
@@ -328,7 +336,7 @@ int Settings::get_cmd(Input argv, Output output) {
 
 void Settings::get_complete(Completion& complete) {
     if (complete == 0) {
-        for (auto& a : attributes()) {
+        for (const auto& a : attributes()) {
             complete.full(a.first);
         }
     } else if (complete == 1) {
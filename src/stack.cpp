@@ -1,16 +1,11 @@
 #include "stack.h"
 
-#include <X11/Xlib.h>
 #include <string>
 
-#include "client.h"
-#include "ewmh.h"
-#include "globals.h"
+#include "displaybackend.h"
 #include "utils.h"
 
 using std::function;
-using std::string;
-using std::stringstream;
 using std::vector;
 
 const std::array<const char*, LAYER_COUNT>g_layer_names =
@@ -23,15 +18,6 @@ const std::array<const char*, LAYER_COUNT>g_layer_names =
 }).a;
 
 
-Stack::~Stack() {
-    for (int i = 0; i < LAYER_COUNT; i++) {
-        if (!layers_[i].empty()) {
-            HSDebug("Warning: %s of stack %p was not empty on destroy\n",
-                    g_layer_names[i], (void*)this);
-        }
-    }
-}
-
 Slice::Slice() {
     layers.insert(LAYER_NORMAL);
 }
@@ -39,7 +25,7 @@ Slice::Slice() {
 Slice* Slice::makeWindowSlice(Window window) {
     auto s = new Slice();
     s->type = Type::WindowSlice;
-    s->data.window = window;
+    s->window_ = window;
     return s;
 }
 
@@ -51,11 +37,14 @@ Slice* Slice::makeFrameSlice(Window window) {
 }
 
 
-Slice* Slice::makeClientSlice(Client* client) {
+Slice* Slice::makeClientSlice(Client* client, Window window,
+                              Window decorationWindow, bool floating) {
     auto s = new Slice();
     s->type = Type::ClientSlice;
-    s->data.client = client;
-    if (client->floating_()) {
+    s->client_ = client;
+    s->window_ = window;
+    s->decorationWindow_ = decorationWindow;
+    if (floating) {
         s->layers.clear();
         s->layers.insert(LAYER_FLOATING);
     }
@@ -84,21 +73,6 @@ void Stack::removeSlice(Slice* elem) {
     dirty = true;
 }
 
-string Slice::getLabel() {
-    stringstream label;
-    switch (type) {
-        case Type::WindowSlice:
-            label << "Window " << WindowID(data.window).str();
-            break;
-        case Type::ClientSlice:
-            label << "Client " << WindowID(data.client->x11Window()).str()
-                  << " \"" << data.client->title_() << "\"";
-            break;
-        default: ;
-    }
-    return label.str();
-}
-
 //! helper function for Stack::toWindowBuf() for a given Slice and layer. The
 //other parameters are as for Stack::toWindowBuf()
 void Slice::extractWindowsFromSlice(bool real_clients, HSLayer layer,
@@ -111,14 +85,14 @@ void Slice::extractWindowsFromSlice(bool real_clients, HSLayer layer,
     switch (type) {
         case Type::ClientSlice:
             if (real_clients) {
-                yield(data.client->x11Window());
+                yield(window_);
             } else {
-                yield(data.client->decorationWindow());
+                yield(decorationWindow_);
             }
             break;
         case Type::WindowSlice:
             if (!real_clients) {
-                yield(data.window);
+                yield(window_);
             }
             break;
     }
@@ -141,9 +115,9 @@ void Stack::restack() {
     }
     vector<Window> buf;
     extractWindows(false, [&buf](Window w) { buf.push_back(w); });
-    XRestackWindows(g_display, buf.data(), buf.size());
+    backend_.restackWindows(buf);
     dirty = false;
-    Ewmh::get().updateClientListStacking();
+    restacked_.emit();
 }
 
 void Stack::raiseSlice(Slice* slice) {
@@ -8,6 +8,7 @@
 #include <string>
 
 #include "plainstack.h"
+#include "signal.h"
 
 enum HSLayer {
     /* layers on each tag, from top to bottom */
@@ -22,6 +23,7 @@ enum HSLayer {
 extern const std::array<const char*, LAYER_COUNT> g_layer_names;
 
 class Client;
+class DisplayBackend;
 
 class Slice {
 public:
@@ -35,9 +37,17 @@ public:
 
     static Slice* makeWindowSlice(Window window);
     static Slice* makeFrameSlice(Window window);
-    static Slice* makeClientSlice(Client* client);
-
-    std::string getLabel();
+    /*! a slice for a client with the given window and decoration window.
+     * The client is only remembered for client(), the stack does not
+     * access it.
+     */
+    static Slice* makeClientSlice(Client* client, Window window,
+                                  Window decorationWindow, bool floating);
+
+    //! the client of a client slice, nullptr otherwise
+    Client* client() const { return client_; }
+    //! the window of a window slice or the client window of a client slice
+    Window window() const { return window_; }
     void extractWindowsFromSlice(bool real_clients, HSLayer layer,
                                  std::function<void(Window)> yield);
 
@@ -46,16 +56,14 @@ private:
     HSLayer highestLayer() const;
 
     Type type = {};
-    union {
-        Client*    client;
-        Window              window;
-    } data = {};
+    Client* client_ = nullptr;
+    Window window_ = 0;
+    Window decorationWindow_ = 0;
 };
 
 class Stack {
 public:
-    Stack() = default;
-    ~Stack();
+    Stack(DisplayBackend& backend) : backend_(backend) {}
 
     void insertSlice(Slice* elem);
     void removeSlice(Slice* elem);
@@ -70,8 +78,11 @@ public:
     void restack();
 
     PlainStack<Slice*> layers_[LAYER_COUNT];
+    //! emitted after the windows were restacked
+    Signal restacked_;
 
 private:
+    DisplayBackend& backend_;
     //! Whether the stacking order has changed but wasn't restacked yet
     bool dirty = false;
 };
@@ -0,0 +1,123 @@
+#include "stats.h"
+
+#include <sstream>
+
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using std::chrono::steady_clock;
+using std::make_pair;
+using std::string;
+using std::unique_ptr;
+
+PhaseStats::PhaseStats()
+    : duration_(this, "duration_us", 0)
+    , requests_(this, "requests", 0)
+{
+}
+
+PhaseTimer::PhaseTimer(Display* display)
+    : start_(steady_clock::now())
+    // the first request of a connection has the sequence number 1
+    , startRequest_(display ? NextRequest(display) : 1)
+{
+}
+
+void PhaseTimer::stop(PhaseStats& stats, Display* display)
+{
+    auto duration = steady_clock::now() - start_;
+    stats.duration_ = duration_cast<microseconds>(duration).count();
+    stats.requests_ = NextRequest(display) - startRequest_;
+}
+
+StartupStats::StartupStats()
+    : connect(*this, "connect")
+    , setup(*this, "setup")
+    , monitors(*this, "monitors")
+    , scan(*this, "scan")
+    , autostart(*this, "autostart")
+    , reload(*this, "reload")
+{
+    connect.init();
+    setup.init();
+    monitors.init();
+    scan.init();
+    autostart.init();
+    reload.init();
+}
+
+CallStats::CallStats()
+    : calls_(this, "calls", 0)
+    , timeTotal_(this, "time_total_us", 0)
+    , timeMax_(this, "time_max_us", 0)
+    , requests_(this, "requests", 0)
+    , histogram_(this, "histogram", &CallStats::histogramStr)
+{
+}
+
+void CallStats::record(microseconds duration, unsigned long requests)
+{
+    unsigned long us = duration.count();
+    calls_ = calls_() + 1;
+    timeTotal_ = timeTotal_() + us;
+    if (us > timeMax_()) {
+        timeMax_ = us;
+    }
+    requests_ = requests_() + requests;
+    size_t bucket = 0;
+    while (us > 0) {
+        us >>= 1;
+        bucket++;
+    }
+    if (bucket >= histogramBuckets_.size()) {
+        histogramBuckets_.resize(bucket + 1, 0);
+    }
+    histogramBuckets_[bucket]++;
+}
+
+//! the bucket sizes, separated by spaces
+string CallStats::histogramStr()
+{
+    std::ostringstream output;
+    for (size_t i = 0; i < histogramBuckets_.size(); i++) {
+        output << (i ? " " : "") << histogramBuckets_[i];
+    }
+    return output.str();
+}
+
+void CallStatsManager::record(const string& name,
+                              microseconds duration,
+                              unsigned long requests)
+{
+    auto it = stats_.find(name);
+    if (it == stats_.end()) {
+        it = stats_.insert(make_pair(name, unique_ptr<CallStats>(new CallStats()))).first;
+        addChild(it->second.get(), name);
+    }
+    it->second->record(duration, requests);
+}
+
+void CallStatsManager::reset()
+{
+    for (const auto& it : stats_) {
+        removeChild(it.first);
+    }
+    stats_.clear();
+}
+
+Stats::Stats()
+    : commands(*this, "commands")
+    , events(*this, "events")
+    , startup(*this, "startup")
+{
+    commands.init();
+    events.init();
+    startup.init();
+}
+
+//! reset the statistics of the commands and the X events
+int Stats::resetCommand()
+{
+    commands->reset();
+    events->reset();
+    return 0;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <X11/Xlib.h>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "attribute_.h"
+#include "child.h"
+#include "object.h"
+
+//! The duration and the number of X requests of a phase of herbstluftwm,
+//! e.g. during startup
+class PhaseStats : public Object {
+public:
+    PhaseStats();
+    Attribute_<unsigned long> duration_; //! in microseconds
+    Attribute_<unsigned long> requests_;
+};
+
+//! Measures a phase: it starts on construction and ends with stop()
+class PhaseTimer {
+public:
+    //! if there is no display yet, then all requests
+    //! sent up to stop() are counted
+    PhaseTimer(Display* display);
+    void stop(PhaseStats& stats, Display* display);
+private:
+    std::chrono::steady_clock::time_point start_;
+    unsigned long startRequest_;
+};
+
+class StartupStats : public Object {
+public:
+    StartupStats();
+    Child_<PhaseStats> connect;
+    Child_<PhaseStats> setup;
+    Child_<PhaseStats> monitors;
+    Child_<PhaseStats> scan;
+    Child_<PhaseStats> autostart;
+    Child_<PhaseStats> reload;
+};
+
+//! The number of calls, the accumulated and the maximal duration, and the
+//! number of X requests of something that is called repeatedly, e.g. a
+//! command or the handler of an X event. The duration of a command includes
+//! the duration of the commands it calls (e.g. in 'chain')
+class CallStats : public Object {
+public:
+    CallStats();
+    void record(std::chrono::microseconds duration, unsigned long requests);
+    Attribute_<unsigned long> calls_;
+    Attribute_<unsigned long> timeTotal_; //! in microseconds
+    Attribute_<unsigned long> timeMax_; //! in microseconds
+    Attribute_<unsigned long> requests_;
+    DynAttribute_<std::string> histogram_;
+private:
+    std::string histogramStr();
+    //! the i'th bucket counts the calls with a duration
+    //! of less than 2^i microseconds (and at least 2^(i-1))
+    std::vector<unsigned long> histogramBuckets_;
+};
+
+//! has a CallStats child for every name recorded so far
+class CallStatsManager : public Object {
+public:
+    CallStatsManager() = default;
+    void record(const std::string& name,
+                std::chrono::microseconds duration,
+                unsigned long requests);
+    void reset();
+private:
+    std::map<std::string, std::unique_ptr<CallStats>> stats_;
+};
+
+class Stats : public Object {
+public:
+    Stats();
+    Child_<CallStatsManager> commands;
+    Child_<CallStatsManager> events;
+    Child_<StartupStats> startup;
+    int resetCommand();
+};
@@ -1,49 +1,59 @@
 #include "tag.h"
 
+#include <cassert>
 #include <type_traits>
 
 #include "argparse.h"
 #include "client.h"
 #include "completion.h"
+#include "ewmh.h"
 #include "floating.h"
 #include "frametree.h"
+#include "globals.h"
 #include "hlwmcommon.h"
 #include "hook.h"
 #include "ipc-protocol.h"
 #include "layout.h"
 #include "monitormanager.h"
-#include "root.h"
 #include "settings.h"
 #include "stack.h"
 #include "tagmanager.h"
 
 using std::endl;
-using std::function;
 using std::make_shared;
 using std::shared_ptr;
 using std::string;
 
 static bool    g_tag_flags_dirty = true;
 
-HSTag::HSTag(string name_, TagManager* tags, Settings* settings)
+HSTag::HSTag(string name_, TagManager* tags, Settings* settings,
+             DisplayBackend& backend)
     : frame(*this, "tiling")
     , index(this, "index", 0)
     , floating(this, "floating", false, [](bool){return "";})
     , floating_focused(this, "floating_focused", false, [](bool){return "";})
     , name(this, "name", name_,
         [tags](string newName) { return tags->isValidTagName(newName); })
-    , frame_count(this, "frame_count", &HSTag::computeFrameCount)
-    , client_count(this, "client_count", &HSTag::computeClientCount)
-    , urgent_count(this, "urgent_count", &HSTag::countUrgentClients)
+    , frame_count(this, "frame_count",
+        [this] () { return frame->leafCount(); } )
+    , client_count(this, "client_count",
+        [this] () { return clientCount_; } )
+    , urgent_count(this, "urgent_count",
+        [this] () { return urgentCount_; } )
     , curframe_windex(this, "curframe_windex",
         [this] () { return frame->focusedFrame()->getSelection(); } )
     , curframe_wcount(this, "curframe_wcount",
         [this] () { return frame->focusedFrame()->clientCount(); } )
     , flags(0)
     , floating_clients_focus_(0)
+    , clientCount_(0)
+    , urgentCount_(0)
     , settings_(settings)
 {
-    stack = make_shared<Stack>();
+    stack = make_shared<Stack>(backend);
+    stack->restacked_.connect([]() {
+        Ewmh::get().updateClientListStacking();
+    });
     frame.init(this, settings);
     floating.changed().connect(this, &HSTag::onGlobalFloatingChange);
     // FIXME: actually this connection of the signals like this
@@ -60,6 +70,12 @@ HSTag::HSTag(string name_, TagManager* tags, Settings* settings)
 
 HSTag::~HSTag() {
     frame.reset();
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        if (!stack->isLayerEmpty((HSLayer)i)) {
+            HSDebug("Warning: %s of tag %s was not empty on destroy\n",
+                    g_layer_names[i], name().c_str());
+        }
+    }
 }
 
 void HSTag::setIndexAttribute(unsigned long new_index) {
@@ -131,6 +147,7 @@ void HSTag::setVisible(bool visible)
 
 bool HSTag::removeClient(Client* client) {
     if (frame->root_->removeClient(client)) {
+        assert(frame->clientFramesConsistent());
         return true;
     }
     auto it = std::find(floating_clients_.begin(), floating_clients_.end(), client);
@@ -147,15 +164,6 @@ bool HSTag::removeClient(Client* client) {
     return true;
 }
 
-void HSTag::foreachClient(function<void (Client *)> loopBody)
-{
-
-    frame->root_->foreachClient(loopBody);
-    for (Client* c: floating_clients_) {
-        loopBody(c);
-    }
-}
-
 void HSTag::focusFrame(shared_ptr<FrameLeaf> frameToFocus)
 {
     floating_focused = false;
@@ -193,6 +201,7 @@ void HSTag::insertClient(Client* client, string frameIndex, bool focus)
             floating_focused = false;
         }
         target->insertClient(client, focus);
+        assert(frame->clientFramesConsistent());
     }
 }
 
@@ -423,31 +432,11 @@ void HSTag::fixFocusIndex()
    }
 }
 
-int HSTag::computeFrameCount() {
-    int count = 0;
-    frame->root_->fmap([](FrameSplit*) {},
-                [&count](FrameLeaf*) { count++; },
-                0);
-    return count;
-}
-
-int HSTag::countUrgentClients()
-{
-    int count = 0;
-    foreachClient([&](Client* client) {
-        if (client->urgent_()) {
-            count++;
-        }
-    });
-    return count;
-}
-
-int HSTag::computeClientCount() {
-    int count = static_cast<int>(floating_clients_.size());
-    frame->root_->fmap([](FrameSplit*) {},
-                [&count](FrameLeaf* l) { count += l->clientCount(); },
-                0);
-    return count;
+void HSTag::adjustClientCounts(int clients, int urgentClients) {
+    clientCount_ += clients;
+    urgentCount_ += urgentClients;
+    assert(clientCount_ >= 0);
+    assert(urgentCount_ >= 0);
 }
 
 int    tag_get_count() {
@@ -469,16 +458,13 @@ HSTag* get_tag_by_index(int index) {
 
 void tag_force_update_flags() {
     g_tag_flags_dirty = false;
-    // unset all tags
     for (auto t : *global_tags) {
         t->flags = 0;
-    }
-    // update flags
-    for (auto c : Root::common().clients()) {
-        auto client = c.second;
-        TAG_SET_FLAG(client->tag(), TAG_FLAG_USED);
-        if (client->urgent_) {
-            TAG_SET_FLAG(client->tag(), TAG_FLAG_URGENT);
+        if (t->clientCount() > 0) {
+            TAG_SET_FLAG(t, TAG_FLAG_USED);
+        }
+        if (t->urgentCount() > 0) {
+            TAG_SET_FLAG(t, TAG_FLAG_URGENT);
         }
     }
 }
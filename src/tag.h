@@ -6,6 +6,7 @@
 
 #include "attribute_.h"
 #include "child.h"
+#include "frametree.h"
 #include "object.h"
 #include "signal.h"
 
@@ -19,15 +20,16 @@ enum {
 
 class Client;
 class Completion;
+class DisplayBackend;
 class FrameLeaf;
-class FrameTree;
 class Settings;
 class Stack;
 class TagManager;
 
 class HSTag : public Object {
 public:
-    HSTag(std::string name, TagManager* tags, Settings* settings);
+    HSTag(std::string name, TagManager* tags, Settings* settings,
+          DisplayBackend& backend);
     ~HSTag() override;
     Child_<FrameTree>        frame;  // the frame tree
     Attribute_<unsigned long> index;
@@ -48,11 +50,17 @@ public:
     void applyFloatingState(Client* client);
     void setVisible(bool visible);
     bool removeClient(Client* client);
-    void foreachClient(std::function<void(Client*)> loopBody);
+    //! call the loop body for every client on this tag, floating or not
+    template <typename ClientAction>
+    void foreachClient(ClientAction&& loopBody);
     void focusFrame(std::shared_ptr<FrameLeaf> frameToFocus);
     Client* focusedClient();
 
     void insertClient(Client* client, std::string frameIndex = {}, bool focus = true);
+    //! adjust the cached number of clients and urgent clients on this tag
+    void adjustClientCounts(int clients, int urgentClients);
+    int clientCount() const { return clientCount_; }
+    int urgentCount() const { return urgentCount_; }
     Signal needsRelayout_;
 
     //! add the client's slice to this tag's stack
@@ -75,15 +83,21 @@ private:
     std::string floatingLayerCanBeFocused(bool floatingFocused);
     void onGlobalFloatingChange(bool newState);
     void fixFocusIndex();
-    //! get the number of clients on this tag
-    int computeClientCount();
-    //! get the number of clients on this tag
-    int computeFrameCount();
-    //! get the number of urgent clients on this tag
-    int countUrgentClients();
+    //! the number of clients whose tag() is this tag
+    int clientCount_;
+    //! the number of urgent clients whose tag() is this tag
+    int urgentCount_;
     Settings* settings_;
 };
 
+template <typename ClientAction>
+void HSTag::foreachClient(ClientAction&& loopBody) {
+    frame->foreachClient(loopBody);
+    for (Client* c: floating_clients_) {
+        loopBody(c);
+    }
+}
+
 // for tags
 HSTag* find_tag(const char* name);
 HSTag* find_tag_with_toplevel_frame(class Frame* frame);
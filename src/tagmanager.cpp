@@ -27,9 +27,10 @@ TagManager::TagManager()
 {
 }
 
-void TagManager::injectDependencies(MonitorManager* m, Settings *s) {
+void TagManager::injectDependencies(MonitorManager* m, Settings *s, DisplayBackend* b) {
     monitors_ = m;
     settings_ = s;
+    backend_ = b;
 }
 
 HSTag* TagManager::find(const string& name) {
@@ -68,7 +69,7 @@ HSTag* TagManager::add_tag(const string& name) {
         // empty name is not allowed
         return nullptr;
     }
-    HSTag* tag = new HSTag(name, this, settings_);
+    HSTag* tag = new HSTag(name, this, settings_, *backend_);
     addIndexed(tag);
     tag->name.changed().connect([this,tag]() { this->onTagRename(tag); });
     tag->needsRelayout_.connect([this,tag]() { this->needsRelayout_.emit(tag); });
@@ -9,6 +9,7 @@
 
 class Client;
 class CommandBinding;
+class DisplayBackend;
 class FrameTree;
 class Monitor;
 class MonitorManager;
@@ -19,7 +20,7 @@ typedef void (FrameTree::*FrameCompleter)(Completion&);
 class TagManager : public IndexingObject<HSTag> {
 public:
     TagManager();
-    void injectDependencies(MonitorManager* m, Settings *s);
+    void injectDependencies(MonitorManager* m, Settings *s, DisplayBackend* b);
 
     int removeTag(Input input, Output output);
     int tag_add_command(Input input, Output output);
@@ -48,6 +49,7 @@ private:
     ByName by_name_;
     MonitorManager* monitors_ = {}; // circular dependency
     Settings* settings_;
+    DisplayBackend* backend_;
     Link_<HSTag> focus_;
 };
 
@@ -67,7 +67,7 @@ DecTriple::DecTriple()
 //! reset all attributes to a default value
 string DecorationScheme::resetSetterHelper(string)
 {
-    for (auto it : attributes()) {
+    for (const auto& it : attributes()) {
         it.second->resetValue();
     }
     return {};
@@ -15,7 +15,9 @@ void TilingResult::add(FrameDecoration* dec, const FrameDecorationData& frame_da
     frames.push_back(make_pair(dec,frame_data));
 }
 
-void TilingResult::mergeFrom(TilingResult& other) {
-    data.splice(data.end(), other.data);
-    frames.splice(frames.end(), other.frames);
+void TilingResult::clear() {
+    focus = {};
+    focused_frame = {};
+    frames.clear();
+    data.clear();
 }
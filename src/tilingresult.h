@@ -1,7 +1,7 @@
 #ifndef __HLWM_TILINGSTEP_H_
 #define __HLWM_TILINGSTEP_H_
 
-#include <list>
+#include <vector>
 
 #include "framedecoration.h"
 #include "x11-types.h"
@@ -22,22 +22,22 @@ public:
                                     //! smart_window_surroundings is active
 };
 
-// a tiling result contains the movement commands etc. for all clients
+// a tiling result contains the movement commands etc. for all clients.
+// The frames of a tree append to the same TilingResult while computing the
+// layout, so it can be reused (with clear()) without reallocating.
 class TilingResult {
 public:
     TilingResult() = default;
     void add(Client* client, const TilingStep& client_data);
     void add(FrameDecoration* dec, const FrameDecorationData& frame_data);
+    //! remove all entries, but keep the allocated capacity
+    void clear();
 
     Client* focus = {}; // the focused client
     FrameDecoration* focused_frame = {};
 
-    // merge all the tiling steps from other into this
-    void mergeFrom(TilingResult& other);
-
-    std::list<std::pair<FrameDecoration*,FrameDecorationData>> frames;
-    std::list<std::pair<Client*,TilingStep>> data;
+    std::vector<std::pair<FrameDecoration*,FrameDecorationData>> frames;
+    std::vector<std::pair<Client*,TilingStep>> data;
 };
 
-
 #endif
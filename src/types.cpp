@@ -2,6 +2,7 @@
 
 #include "completion.h"
 
+using std::make_shared;
 using std::string;
 
 Input &Input::operator>>(string &val)
@@ -12,24 +13,31 @@ Input &Input::operator>>(string &val)
 
 Input Input::fromHere()
 {
-    string cmd;
-    if (empty()) {
+    return fromRange(begin(), end());
+}
+
+Input Input::fromRange(Container::const_iterator from, Container::const_iterator to)
+{
+    if (from == to) {
         return {{}, {}};
     }
-
-    return Input(*(begin()), Container(begin() + 1, end()));
+    return Input(*from, container_, from + 1, to);
 }
 
 void Input::replace(const string &from, const string &to)
 {
-    for (auto &v : *container_) {
+    // the container may be shared with other inputs, so
+    // replace in a copy of the arguments
+    auto replaced = make_shared<Container>(begin(), end());
+    for (auto &v : *replaced) {
         if (v == from) {
             v = to;
         }
-
-        if (*command_ == from) {
-            *command_ = to;
-        }
+    }
+    container_ = replaced;
+    setFullRange();
+    if (*command_ == from) {
+        command_ = make_shared<string>(to);
     }
 }
 
@@ -41,14 +41,23 @@ public:
     //! construct a new Input where the first (current) arg is the command
     Input fromHere();
 
+    //! construct a new Input from the range [from, to) of this input, where
+    //! the first element is the command. The argument vector is shared and
+    //! not copied.
+    Input fromRange(Container::const_iterator from, Container::const_iterator to);
+
     //! Replace every occurence of 'from' by 'to'
     //! @note this includes the command itself
     void replace(const std::string &from, const std::string &to);
 
 protected:
+    Input(const std::string command, std::shared_ptr<Container> container,
+          Container::const_iterator from, Container::const_iterator to)
+        : ArgList(container, from, to)
+        , command_(std::make_shared<std::string>(command)) {}
+
     //! Command name
     //! A shared pointer to avoid copies when passing Input around
-    //! @note The C-style compatibility layer DEPENDS on the shared_ptr!
     std::shared_ptr<std::string> command_;
 };
 
@@ -107,8 +116,8 @@ inline std::string Converter<bool>::str(bool payload) {
 }
 template<>
 inline bool Converter<bool>::parse(const std::string &payload) {
-    std::set<std::string> t = {"true", "on", "1"};
-    std::set<std::string> f = {"false", "off", "0"};
+    static const std::set<std::string> t = {"true", "on", "1"};
+    static const std::set<std::string> f = {"false", "off", "0"};
     if (f.find(payload) != f.end()) {
         return false;
     }
@@ -61,8 +61,12 @@ string window_class_to_string(Display* dpy, Window window) {
 }
 
 bool is_herbstluft_window(Display* dpy, Window window) {
-    auto str = window_class_to_string(dpy, window);
-    return str == HERBST_FRAME_CLASS || str == HERBST_DECORATION_CLASS;
+    return is_herbstluft_class(window_class_to_string(dpy, window));
+}
+
+bool is_herbstluft_class(const string& window_class) {
+    return window_class == HERBST_FRAME_CLASS
+        || window_class == HERBST_DECORATION_CLASS;
 }
 
 // duplicates an argument-vector
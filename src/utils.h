@@ -43,6 +43,7 @@ void tree_print_to(std::shared_ptr<TreeInterface> intface, Output output);
 
 
 bool is_herbstluft_window(Display* dpy, Window window);
+bool is_herbstluft_class(const std::string& window_class);
 
 time_t get_monotonic_timestamp();
 
@@ -0,0 +1,47 @@
+#include "xbackend.h"
+
+#include <X11/Xlib.h>
+
+#include "xconnection.h"
+
+using std::pair;
+using std::string;
+using std::vector;
+
+pair<string, string> XBackend::windowClass(Window window) {
+    return X_.getClassHint(window);
+}
+
+void XBackend::restackWindows(const vector<Window>& windows) {
+    // XRestackWindows() does not modify the array
+    XRestackWindows(X_.display(), const_cast<Window*>(windows.data()),
+                    windows.size());
+}
+
+void XBackend::moveResizeWindow(Window window, Rectangle geometry) {
+    XMoveResizeWindow(X_.display(), window,
+                      geometry.x, geometry.y, geometry.width, geometry.height);
+}
+
+void XBackend::configureClientWindow(Window window, Rectangle geometry) {
+    XWindowChanges changes;
+    changes.x = geometry.x;
+    changes.y = geometry.y;
+    changes.width = geometry.width;
+    changes.height = geometry.height;
+    changes.border_width = 0;
+    int mask = CWX | CWY | CWWidth | CWHeight | CWBorderWidth;
+    XConfigureWindow(X_.display(), window, mask, &changes);
+}
+
+void XBackend::setWindowBackground(Window window, Pixmap pixmap) {
+    XSetWindowBackgroundPixmap(X_.display(), window, pixmap);
+}
+
+void XBackend::clearWindow(Window window) {
+    XClearWindow(X_.display(), window);
+}
+
+void XBackend::sync() {
+    XSync(X_.display(), False);
+}
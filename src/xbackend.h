@@ -0,0 +1,25 @@
+#ifndef HERBSTLUFT_XBACKEND_H
+#define HERBSTLUFT_XBACKEND_H
+
+#include "displaybackend.h"
+
+class XConnection;
+
+//! the DisplayBackend that sends the requests to the X server
+class XBackend : public DisplayBackend {
+public:
+    XBackend(XConnection& xconnection) : X_(xconnection) {}
+
+    std::pair<std::string, std::string> windowClass(Window window) override;
+    void restackWindows(const std::vector<Window>& windows) override;
+    void moveResizeWindow(Window window, Rectangle geometry) override;
+    void configureClientWindow(Window window, Rectangle geometry) override;
+    void setWindowBackground(Window window, Pixmap pixmap) override;
+    void clearWindow(Window window) override;
+    void sync() override;
+
+private:
+    XConnection& X_;
+};
+
+#endif
@@ -155,15 +155,6 @@ int XConnection::windowPid(Window window) {
     }
 }
 
-//! The pgid of a window or -1 if the pid is not set
-int XConnection::windowPgid(Window window) {
-    auto pid = windowPid(window);
-    if (pid == -1) {
-        return -1;
-    }
-    return getpgid(pid);
-}
-
 //! wrapper around XGetClassHint returning the window's instance and class name
 pair<string, string> XConnection::getClassHint(Window window) {
     XClassHint hint;
@@ -7,6 +7,7 @@
 
 #include "globals.h"
 
+using std::make_pair;
 using std::vector;
 using std::string;
 
@@ -61,6 +62,8 @@ void XKeyGrabber::ungrabKeyCombo(const KeyCombo& keyCombo) {
 //! Removes all grabbed keys (without knowing them)
 void XKeyGrabber::ungrabAll() {
     XUngrabKey(g_display, AnyKey, AnyModifier, g_root);
+    ungrabRequests_++;
+    grabs_.clear();
 }
 
 //! Grabs/ungrabs a given key combo
@@ -74,6 +77,25 @@ void XKeyGrabber::changeGrabbedState(const KeyCombo& keyCombo, bool grabbed) {
         return;
     }
 
+    // only talk to the X server if the grab state of the keycode changes
+    auto key = make_pair(keycode, keyCombo.modifiers_);
+    if (grabbed) {
+        if (grabs_[key]++ > 0) {
+            return;
+        }
+        grabRequests_ += sizeof(ignModifiers) / sizeof(ignModifiers[0]);
+    } else {
+        auto it = grabs_.find(key);
+        if (it == grabs_.end()) {
+            return;
+        }
+        if (--(it->second) > 0) {
+            return;
+        }
+        grabs_.erase(it);
+        ungrabRequests_ += sizeof(ignModifiers) / sizeof(ignModifiers[0]);
+    }
+
     // Grab/ungrab key for each modifier that is ignored (capslock, numlock)
     for (auto& ignModifier : ignModifiers) {
         if (grabbed) {
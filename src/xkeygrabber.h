@@ -1,7 +1,9 @@
 #pragma once
 
 #include <X11/Xlib.h>
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "keycombo.h"
@@ -12,6 +14,9 @@
  *
  * Expects to be notified about keyboard mapping changes so that it can keep
  * track of the current numlock mask value.
+ *
+ * It keeps track of the grabbed keys, such that X requests are only issued
+ * for keys whose grab state actually changes.
  */
 class XKeyGrabber {
 public:
@@ -33,9 +38,21 @@ public:
 
     static std::vector<std::string> getPossibleKeySyms();
 
+    //! the number of XGrabKey requests issued so far
+    unsigned long grabRequests() const { return grabRequests_; }
+    //! the number of XUngrabKey requests issued so far
+    unsigned long ungrabRequests() const { return ungrabRequests_; }
+
 private:
     void changeGrabbedState(const KeyCombo& keyCombo, bool grabbed);
     unsigned int numlockMask_ = 0;
 
+    //! for each grabbed keycode and modifier mask (without the ignored
+    //! modifiers), the number of key combos that requested the grab.
+    //! Different keysyms may share a keycode.
+    std::map<std::pair<KeyCode, unsigned int>, int> grabs_;
+    unsigned long grabRequests_ = 0;
+    unsigned long ungrabRequests_ = 0;
+
 };
 
@@ -3,6 +3,7 @@
 #include <X11/X.h>
 #include <X11/Xatom.h>
 #include <X11/Xlib.h>
+#include <chrono>
 #include <iostream>
 #include <memory>
 
@@ -24,11 +25,15 @@
 #include "root.h"
 #include "rules.h"
 #include "settings.h"
+#include "stats.h"
 #include "tag.h"
 #include "tagmanager.h"
 #include "utils.h"
 #include "xconnection.h"
 
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using std::chrono::steady_clock;
 using std::function;
 using std::shared_ptr;
 
@@ -45,6 +50,22 @@ inline XMainLoop::EventHandler EH(void (XMainLoop::*handler)(T*)) {
     return (XMainLoop::EventHandler) handler;
 }
 
+//! the name of a core X event type
+static const char* eventTypeName(int type) {
+    static const char* names[LASTEvent] = {
+        "", "", "KeyPress", "KeyRelease", "ButtonPress", "ButtonRelease",
+        "MotionNotify", "EnterNotify", "LeaveNotify", "FocusIn", "FocusOut",
+        "KeymapNotify", "Expose", "GraphicsExpose", "NoExpose",
+        "VisibilityNotify", "CreateNotify", "DestroyNotify", "UnmapNotify",
+        "MapNotify", "MapRequest", "ReparentNotify", "ConfigureNotify",
+        "ConfigureRequest", "GravityNotify", "ResizeRequest",
+        "CirculateNotify", "CirculateRequest", "PropertyNotify",
+        "SelectionClear", "SelectionRequest", "SelectionNotify",
+        "ColormapNotify", "ClientMessage", "MappingNotify", "GenericEvent",
+    };
+    return names[type];
+}
+
 XMainLoop::XMainLoop(XConnection& X, Root* root)
     : X_(X)
     , root_(root)
@@ -100,6 +121,9 @@ void XMainLoop::scanExistingClients() {
                 }
             };
     };
+    // defer the layouting of the monitors until all windows are managed
+    // instead of re-applying the layout for every single window
+    root_->monitors->lock();
     for (auto win : X_.queryTree(X_.root())) {
         if (!XGetWindowAttributes(X_.display(), win, &wa) || wa.override_redirect)
         {
@@ -113,13 +137,14 @@ void XMainLoop::scanExistingClients() {
         if (root_->ewmh->isOwnWindow(win)) {
             continue;
         }
-        if (root_->ewmh->getWindowType(win) == NetWmWindowTypeDesktop)
+        int windowType = root_->ewmh->getWindowType(win);
+        if (windowType == NetWmWindowTypeDesktop)
         {
             DesktopWindow::registerDesktop(win);
             DesktopWindow::lowerDesktopWindows();
             XMapWindow(X_.display(), win);
         }
-        else if (root_->ewmh->getWindowType(win) == NetWmWindowTypeDock)
+        else if (windowType == NetWmWindowTypeDock)
         {
             root_->panels->registerPanel(win);
             XSelectInput(X_.display(), win, PropertyChangeMask);
@@ -128,7 +153,7 @@ void XMainLoop::scanExistingClients() {
         else if (wa.map_state == IsViewable
             || isInOriginalClients(win)) {
             Client* c = clientmanager->manage_client(win, true, false, findTagForWindow(win));
-            if (root_->monitors->byTag(c->tag())) {
+            if (c && root_->monitors->byTag(c->tag())) {
                 XMapWindow(X_.display(), win);
             }
         }
@@ -146,6 +171,7 @@ void XMainLoop::scanExistingClients() {
         XReparentWindow(X_.display(), win, X_.root(), 0,0);
         clientmanager->manage_client(win, true, false, findTagForWindow(win));
     }
+    root_->monitors->unlock();
 }
 
 
@@ -167,7 +193,14 @@ void XMainLoop::run() {
             XNextEvent(X_.display(), &event);
             EventHandler handler = handlerTable_[event.type];
             if (handler != nullptr) {
+                auto start = steady_clock::now();
+                unsigned long firstRequest = NextRequest(X_.display());
                 (this ->* handler)(&event);
+                auto duration = steady_clock::now() - start;
+                root_->stats->events->record(
+                        eventTypeName(event.type),
+                        duration_cast<microseconds>(duration),
+                        NextRequest(X_.display()) - firstRequest);
             }
             XSync(X_.display(), False);
         }
@@ -464,13 +497,14 @@ void XMainLoop::maprequest(XMapRequestEvent* mapreq) {
         }
         XMapWindow(X_.display(), window);
     } else if (c == nullptr) {
-        if (root_->ewmh->getWindowType(window) == NetWmWindowTypeDesktop)
+        int windowType = root_->ewmh->getWindowType(window);
+        if (windowType == NetWmWindowTypeDesktop)
         {
             DesktopWindow::registerDesktop(window);
             DesktopWindow::lowerDesktopWindows();
             XMapWindow(X_.display(), window);
         }
-        else if (root_->ewmh->getWindowType(window) == NetWmWindowTypeDock)
+        else if (windowType == NetWmWindowTypeDock)
         {
             root_->panels->registerPanel(window);
             XSelectInput(X_.display(), window, PropertyChangeMask);
@@ -502,6 +536,7 @@ void XMainLoop::propertynotify(XPropertyEvent* ev) {
             //        client->window_id_str().c_str(),
             //        ev->atom,
             //        atomname);
+            client->propertyChanged(ev->atom);
             if (ev->atom == XA_WM_HINTS) {
                 client->update_wm_hints();
             } else if (ev->atom == XA_WM_NORMAL_HINTS) {
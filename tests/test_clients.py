@@ -140,6 +140,17 @@ def test_client_wm_class(hlwm, x11):
     assert hlwm.get_attr('clients.{}.class'.format(winid)) == 'myclass'
 
 
+def test_client_wm_class_changed(hlwm, x11):
+    winref, winid = x11.create_client(wm_class=('myinst', 'myclass'))
+    assert hlwm.get_attr('clients.{}.class'.format(winid)) == 'myclass'
+
+    winref.set_wm_class('otherinst', 'otherclass')
+    x11.display.sync()
+
+    assert hlwm.get_attr('clients.{}.instance'.format(winid)) == 'otherinst'
+    assert hlwm.get_attr('clients.{}.class'.format(winid)) == 'otherclass'
+
+
 def test_client_wm_class_none(hlwm, x11):
     _, winid = x11.create_client(wm_class=None)
     assert hlwm.get_attr('clients.{}.instance'.format(winid)) == ''
@@ -17,6 +17,7 @@ commands_without_input = shlex.split(
     quit
     reload
     remove
+    reset_stats
     rotate
     stack
     true
@@ -3,7 +3,7 @@ import os
 import pytest
 import subprocess
 import textwrap
-from conftest import BINDIR, HlwmProcess
+from conftest import BINDIR, HlwmBridge, HlwmProcess
 import conftest
 
 
@@ -74,6 +74,66 @@ def test_autostart_path(tmpdir, method, xvfb):
     hlwm_proc.shutdown()
 
 
+def test_autostart_relative_path_not_looked_up_in_path(tmpdir, xvfb, monkeypatch):
+    bindir = tmpdir / 'bin'
+    for directory, message in [(tmpdir, 'relative autostart'),
+                               (bindir, 'autostart from PATH')]:
+        autostart = directory / 'somename'
+        autostart.ensure()
+        autostart.write(textwrap.dedent(f"""
+            #!/usr/bin/env bash
+            echo "hlwm {message}"
+        """.lstrip('\n')))
+        autostart.chmod(0o755)
+    env = {
+        'DISPLAY': xvfb.display,
+        'PATH': str(bindir) + ':' + os.environ['PATH'],
+    }
+    env = conftest.extend_env_with_whitelist(env)
+    # the path has no slash, but still refers to the working directory
+    monkeypatch.chdir(tmpdir)
+    hlwm_proc = HlwmProcess('hlwm relative autostart', env,
+                            ['--autostart', 'somename'])
+    hlwm_proc.shutdown()
+
+
+@pytest.mark.parametrize("shebang", [False, True])
+def test_autostart_command_file(tmpdir, xvfb, shebang):
+    env = {
+        'DISPLAY': xvfb.display,
+    }
+    autostart = tmpdir / 'somename'
+    autostart.ensure()
+    if shebang:
+        # a script is executed even with --autostart-commands
+        autostart.write(textwrap.dedent("""
+            #!/usr/bin/env bash
+            echo "hlwm command file test"
+        """.lstrip('\n')))
+        autostart.chmod(0o755)
+    else:
+        autostart.write(textwrap.dedent("""
+            # the autostart file is a list of commands
+            chain , add 'tag two' , set frame_gap 7
+            echo "hlwm command file" test
+        """.lstrip('\n')))
+        autostart.chmod(0o644)
+    env = conftest.extend_env_with_whitelist(env)
+    hlwm_proc = HlwmProcess('hlwm command file test', env,
+                            ['--autostart-commands', '--autostart', str(autostart)])
+    hlwm = HlwmBridge(xvfb.display, hlwm_proc)
+
+    if shebang:
+        assert hlwm.get_attr('tags.count') == '1'
+    else:
+        assert hlwm.get_attr('tags.count') == '2'
+        assert hlwm.get_attr('tags.1.name') == 'tag two'
+        assert hlwm.get_attr('settings.frame_gap') == '7'
+
+    hlwm.shutdown()
+    hlwm_proc.shutdown()
+
+
 def test_no_autostart(xvfb):
     # no HOME, no XDG_CONFIG_HOME
     env = {
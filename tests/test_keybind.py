@@ -32,6 +32,28 @@ def test_replace_keybind(hlwm):
     assert hlwm.call('list_keybinds').stdout == 'Mod1+x\tcycle\n'
 
 
+def test_replace_keybind_issues_no_grab_requests(hlwm):
+    hlwm.call('keybind Mod1+x quit')
+    grabs = hlwm.get_attr('keys.grab_requests')
+    ungrabs = hlwm.get_attr('keys.ungrab_requests')
+
+    hlwm.call('keybind Mod1+x cycle')
+
+    assert hlwm.get_attr('keys.grab_requests') == grabs
+    assert hlwm.get_attr('keys.ungrab_requests') == ungrabs
+
+
+def test_keyunbind_only_ungrabs_binding(hlwm):
+    hlwm.call('keybind Mod1+x cycle')
+    hlwm.call('keybind Mod1+y quit')
+    grabs = hlwm.get_attr('keys.grab_requests')
+
+    hlwm.call('keyunbind Mod1+y')
+
+    # the other binding is not grabbed again
+    assert hlwm.get_attr('keys.grab_requests') == grabs
+
+
 def test_keyunbind_specific_binding(hlwm, keyboard):
     hlwm.call('keybind Mod1+x cycle')
     hlwm.call('keybind Ctrl+y quit')
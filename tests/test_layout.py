@@ -988,3 +988,20 @@ def test_frame_index_attribute(hlwm):
         # after each splitting operation, check that
         # the frame's index attribute is correct:
         verify_frame_tree('tags.focus.tiling.root', '')
+
+
+def test_master_layout_neighbours(hlwm):
+    master, stack1, stack2 = hlwm.create_clients(3)
+    hlwm.call(['load', f'(clients master:0 {master} {stack1} {stack2})'])
+
+    hlwm.call('focus right')
+    assert hlwm.get_attr('clients.focus.winid') == stack1
+    hlwm.call('focus down')
+    assert hlwm.get_attr('clients.focus.winid') == stack2
+    hlwm.call('focus left')
+    assert hlwm.get_attr('clients.focus.winid') == master
+
+
+def test_master_width_percent_invalid(hlwm):
+    hlwm.call_xfail('set master_width_percent 100') \
+        .expect_stderr('must be between 1 and 99')
@@ -134,6 +134,21 @@ def test_load_brings_windows(hlwm, running_clients, running_clients_num, num_bri
     assert hlwm.call('dump other').stdout == layout
 
 
+@pytest.mark.parametrize("running_clients_num", [2])
+def test_jumpto_after_load_moved_client(hlwm, running_clients, running_clients_num):
+    hlwm.call(['load', '(split horizontal:0.5:0 (clients max:0 {}) (clients max:0 {}))'
+               .format(*running_clients)])
+    # swap the clients between the two frames
+    layout = '(split horizontal:0.5:0 (clients max:0 {}) (clients max:0 {}))' \
+        .format(*reversed(running_clients))
+    hlwm.call(['load', layout])
+
+    hlwm.call(['jumpto', running_clients[0]])
+
+    assert hlwm.get_attr('clients.focus.winid') == running_clients[0]
+    assert hlwm.get_attr('tags.focus.tiling.root.selection') == '1'
+
+
 def test_load_invalid_tag(hlwm):
     hlwm.call_xfail(['load', 'invalidtagname', '(clients vertical:0)']) \
         .expect_stderr(r'Tag.*not found')
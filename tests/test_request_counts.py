@@ -0,0 +1,84 @@
+import pytest
+
+# The number of X requests that herbstluftwm sends for common operations.
+# Every scenario runs on a fresh tag, once to warm up (e.g. to intern atoms
+# that are needed for the first time) and then for the measurement. The
+# measured count must not exceed the pinned count, which is the count that
+# was measured when the scenario was added (without any margin). If an
+# operation gets cheaper, lower its number. Finally, the scenario runs again
+# after further clients were mapped on a hidden tag and must send exactly as
+# many requests, because an operation on the focused tag must not touch the
+# clients of hidden tags.
+#
+# The clients are plain python-xlib windows, so the counts do not depend on
+# the window properties that a particular terminal version sets.
+
+
+def command_requests(hlwm, command):
+    """run the given command and return the number of X requests it sent"""
+    hlwm.call('reset_stats')
+    hlwm.call(command)
+    return int(hlwm.get_attr(f'stats.commands.{command[0]}.requests'))
+
+
+def create_clients(x11, count):
+    return [x11.create_client()[1] for _ in range(count)]
+
+
+def focus_change(hlwm, x11, tag):
+    create_clients(x11, 2)
+    hlwm.call('split explode')
+    return command_requests(hlwm, ['cycle_frame'])
+
+
+def split(hlwm, x11, tag):
+    create_clients(x11, 2)
+    return command_requests(hlwm, ['split', 'bottom', '0.5'])
+
+
+def map_window(hlwm, x11, tag):
+    hlwm.call('reset_stats')
+    x11.create_client()
+    return int(hlwm.get_attr('stats.events.MapRequest.requests'))
+
+
+def tag_switch(hlwm, x11, tag):
+    create_clients(x11, 2)
+    target = tag + '_target'
+    hlwm.call(['add', target])
+    hlwm.call(['rule', 'tag=' + target, 'focus=off'])
+    create_clients(x11, 2)
+    hlwm.call('unrule -F')
+    return command_requests(hlwm, ['use', target])
+
+
+def load(hlwm, x11, tag):
+    winid1, winid2 = create_clients(x11, 2)
+    layout = '(split horizontal:0.5:0 (clients vertical:0 {}) ' \
+        '(clients max:0 {}))'.format(winid1, winid2)
+    return command_requests(hlwm, ['load', tag, layout])
+
+
+@pytest.mark.parametrize('scenario,max_requests', [
+    (focus_change, 62),
+    (split, 57),
+    (map_window, 103),
+    (tag_switch, 74),
+    (load, 195),
+])
+def test_request_count(hlwm, x11, scenario, max_requests):
+    def run_on_new_tag(tag):
+        hlwm.call(['add', tag])
+        hlwm.call(['use', tag])
+        return scenario(hlwm, x11, tag)
+
+    run_on_new_tag('warmup')
+    baseline = run_on_new_tag('first')
+    assert 0 < baseline <= max_requests
+
+    hlwm.call('add hidden')
+    hlwm.call('rule tag=hidden focus=off')
+    create_clients(x11, 10)
+    hlwm.call('unrule -F')
+
+    assert run_on_new_tag('second') == baseline
@@ -310,6 +310,34 @@ def test_compare_invalid_operator(hlwm):
         .expect_stderr('unknown operator')
 
 
+@pytest.mark.parametrize('oper,value,expected', [
+    ('=', '1', True),
+    ('!=', '1', False),
+    ('ge', '1', True),
+    ('gt', '1', False),
+    ('lt', '2', True),
+])
+def test_compare_numeric(hlwm, oper, value, expected):
+    proc = hlwm.unchecked_call(['compare', 'monitors.count', oper, value])
+
+    assert (proc.returncode == 0) == expected
+
+
+def test_compare_unparsable_value(hlwm):
+    hlwm.call_xfail('compare monitors.count = foo') \
+        .expect_stderr('cannot parse "foo"')
+
+
+def test_compare_unsigned_negative_value(hlwm):
+    # monitors.count is unsigned, so -1 is not a valid value for it
+    hlwm.call_xfail('compare monitors.count lt -1') \
+        .expect_stderr('cannot parse "-1".*out of range')
+
+
+def test_compare_unsigned_beyond_int(hlwm):
+    hlwm.call('compare monitors.count lt 4294967296')
+
+
 def test_try_command(hlwm):
     proc = hlwm.unchecked_call('try chain , echo foo , false')
 
@@ -356,6 +384,14 @@ def test_chain_nested(hlwm):
         == 'a\nb Y echo c\n'
 
 
+def test_chain_substitute_does_not_affect_other_commands(hlwm):
+    count = hlwm.get_attr('tags.count')
+
+    proc = hlwm.call('chain , substitute X tags.count echo X , echo X')
+
+    assert proc.stdout == count + '\nX\n'
+
+
 def test_chain_and_1(hlwm):
     proc = hlwm.unchecked_call('and , echo foo , false , echo bar')
     assert proc.returncode == 1
@@ -268,6 +268,36 @@ def test_condition_regexp_match(hlwm):
     assert hlwm.get_attr('clients', winid, 'tag') == 'tag2'
 
 
+@pytest.mark.parametrize('regex,matches', [
+    ('foo|bar', True),
+    ('bar|foo', True),
+    ('fo|bar', False),
+    ('foo', True),
+    ('fooo', False),
+])
+def test_condition_regexp_literal_alternatives(hlwm, regex, matches):
+    hlwm.call('add tag2')
+
+    hlwm.call(['rule', 'title~' + regex, 'tag=tag2'])
+    winid, _ = hlwm.create_client(title='foo')
+
+    expected_tag = 'tag2' if matches else 'default'
+    assert hlwm.get_attr('clients', winid, 'tag') == expected_tag
+
+
+def test_all_rules_with_same_condition_apply(hlwm):
+    # a rule matching does not stop the evaluation of the later rules,
+    # even if their condition is exactly the same
+    hlwm.call('add tag2')
+
+    hlwm.call('rule title~f.o tag=tag2')
+    hlwm.call('rule title~f.o floating=on')
+    winid, _ = hlwm.create_client(title='foo')
+
+    assert hlwm.get_attr('clients', winid, 'tag') == 'tag2'
+    assert hlwm.get_attr('clients', winid, 'floating') == 'true'
+
+
 def test_condition_maxage(hlwm):
     hlwm.call('add tag2')
 
@@ -70,9 +70,18 @@ def test_cycle_value_loop(hlwm):
         assert hlwm.get_attr('settings.' + name) == expected
 
 
+def test_cycle_value_bool_synonyms(hlwm):
+    name = 'update_dragged_clients'
+    hlwm.call(f'set {name} true')
+
+    for expected in ['false', 'true', 'false']:
+        hlwm.call(['cycle_value', name, 'on', 'off'])
+        assert hlwm.get_attr('settings.' + name) == expected
+
+
 def test_default_frame_layout_value_too_high(hlwm):
     hlwm.call_xfail('set default_frame_layout 99') \
-        .expect_stderr('set: Invalid value "99" for setting "default_frame_layout": layout number must be at most 3')
+        .expect_stderr('set: Invalid value "99" for setting "default_frame_layout": layout number must be at most 4')
 
 
 def test_default_frame_layout_value_negative(hlwm):
@@ -5,3 +5,10 @@ def test_spawn(hlwm, hlwm_process):
         assert proc.returncode == 0
         assert not proc.stderr
         assert not proc.stdout
+
+
+def test_spawn_nonexisting_command(hlwm, hlwm_process):
+    with hlwm_process.wait_stderr_match('execvp "nonexistingcommand" failed'):
+        cmd = ['spawn', 'nonexistingcommand']
+        proc = hlwm.unchecked_call(cmd, read_hlwm_output=False)
+        assert proc.returncode == 0
@@ -0,0 +1,68 @@
+def test_startup_stats(hlwm):
+    phases = ['autostart', 'connect', 'monitors', 'reload', 'scan', 'setup']
+    assert hlwm.list_children('stats.startup') == phases
+    for phase in ['connect', 'setup', 'monitors', 'scan']:
+        assert int(hlwm.get_attr(f'stats.startup.{phase}.duration_us')) > 0
+        assert int(hlwm.get_attr(f'stats.startup.{phase}.requests')) > 0
+    # the autostart script runs in its own process, so starting it does not
+    # send any request
+    assert int(hlwm.get_attr('stats.startup.autostart.duration_us')) > 0
+    assert hlwm.get_attr('stats.startup.autostart.requests') == '0'
+    assert hlwm.call_xfail('set_attr stats.startup.scan.requests 0') \
+        .returncode == 3
+
+
+def test_reload_stats(hlwm):
+    assert hlwm.get_attr('stats.startup.reload.duration_us') == '0'
+    hlwm.call('reload')
+    assert int(hlwm.get_attr('stats.startup.reload.duration_us')) > 0
+
+
+def test_command_stats(hlwm):
+    hlwm.call('reset_stats')
+    hlwm.call('chain , echo foo , echo bar , true')
+
+    assert hlwm.get_attr('stats.commands.chain.calls') == '1'
+    assert hlwm.get_attr('stats.commands.echo.calls') == '2'
+    assert hlwm.get_attr('stats.commands.true.calls') == '1'
+    chain_time = int(hlwm.get_attr('stats.commands.chain.time_total_us'))
+    echo_time = int(hlwm.get_attr('stats.commands.echo.time_total_us'))
+    assert chain_time >= echo_time
+    assert int(hlwm.get_attr('stats.commands.echo.time_max_us')) <= echo_time
+
+
+def test_command_stats_requests(hlwm):
+    hlwm.call('reset_stats')
+    hlwm.call('add tag2')
+    hlwm.call('use tag2')
+
+    assert int(hlwm.get_attr('stats.commands.use.requests')) > 0
+
+
+def test_reset_stats(hlwm):
+    hlwm.call('true')
+    assert 'true' in hlwm.list_children('stats.commands')
+
+    hlwm.call('reset_stats')
+
+    # the only command called since then is reset_stats itself
+    assert hlwm.list_children('stats.commands') == ['reset_stats']
+
+
+def test_event_stats(hlwm):
+    hlwm.call('reset_stats')
+    hlwm.create_client()
+
+    assert int(hlwm.get_attr('stats.events.MapRequest.calls')) >= 1
+    histogram = hlwm.get_attr('stats.events.MapRequest.histogram').split(' ')
+    assert sum(map(int, histogram)) \
+        == int(hlwm.get_attr('stats.events.MapRequest.calls'))
+
+
+def test_reset_stats_clears_events(hlwm):
+    hlwm.create_client()
+    assert 'MapRequest' in hlwm.list_children('stats.events')
+
+    hlwm.call('reset_stats')
+
+    assert 'MapRequest' not in hlwm.list_children('stats.events')
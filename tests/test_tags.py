@@ -256,3 +256,24 @@ def test_urgent_count(hlwm, x11):
 
     # since one of them gets focused, 4 urgent clients remain
     assert int(hlwm.get_attr('tags.focus.urgent_count')) == 4
+
+
+def test_counts_follow_merged_and_unmapped_clients(hlwm, x11):
+    hlwm.call('add other')
+    hlwm.call('rule once tag=other')
+    window, winid = x11.create_client(urgent=True)
+    assert hlwm.get_attr('tags.1.client_count') == '1'
+    assert hlwm.get_attr('tags.1.urgent_count') == '1'
+
+    hlwm.call('merge_tag other')
+
+    assert hlwm.get_attr('tags.0.client_count') == '1'
+    # the client may have been focused and thus lost its urgent flag
+    urgent = hlwm.get_attr('clients.{}.urgent'.format(winid)) == 'true'
+    assert hlwm.get_attr('tags.0.urgent_count') == ('1' if urgent else '0')
+
+    window.unmap()
+    x11.display.sync()
+
+    assert hlwm.get_attr('tags.0.client_count') == '0'
+    assert hlwm.get_attr('tags.0.urgent_count') == '0'
@@ -0,0 +1,207 @@
+#include <string>
+#include <vector>
+
+#include "layoutengine.h"
+#include "tilingresult.h"
+#include "unittest.h"
+
+using std::string;
+using std::to_string;
+using std::vector;
+
+//! distinct client pointers that are never dereferenced
+static vector<Client*> placeholderClients(size_t count) {
+    static char storage[16];
+    vector<Client*> clients;
+    for (size_t i = 0; i < count; i++) {
+        clients.push_back(reinterpret_cast<Client*>(storage + i));
+    }
+    return clients;
+}
+
+class ClientState : public LayoutClientState {
+public:
+    ClientState(bool pseudotiled = false) : pseudotiled_(pseudotiled) {}
+    bool pseudotiled(size_t) const override {
+        return pseudotiled_;
+    }
+private:
+    bool pseudotiled_;
+};
+
+//! the geometry as "X Y WIDTH HEIGHT", because Rectangle::operator==
+//! is not part of the core library
+static string geometry(const Rectangle& rect) {
+    return to_string(rect.x) + " " + to_string(rect.y) + " "
+        + to_string(rect.width) + " " + to_string(rect.height);
+}
+
+//! the tiling step of the given client
+static const TilingStep& stepOf(const TilingResult& res, Client* client) {
+    for (const auto& entry : res.data) {
+        if (entry.first == client) {
+            return entry.second;
+        }
+    }
+    UnitTest::fail(__FILE__, __LINE__, "client without tiling step");
+    return res.data.front().second;
+}
+
+static TilingResult apply(LayoutAlgorithm algorithm,
+                          const vector<Client*>& clients, int selection,
+                          Rectangle rect,
+                          const LayoutOptions& options = {},
+                          const ClientState& state = {})
+{
+    TilingResult res;
+    LayoutEngine::forAlgorithm(algorithm)
+        .apply(clients, state, selection, rect, options, res);
+    return res;
+}
+
+static int neighbour(LayoutAlgorithm algorithm, int count, int selection,
+                     Direction direction, const LayoutOptions& options = {})
+{
+    return LayoutEngine::forAlgorithm(algorithm)
+        .neighbourIndex(count, selection, direction, options);
+}
+
+TEST(vertical_apply) {
+    auto clients = placeholderClients(3);
+    auto res = apply(LayoutAlgorithm::vertical, clients, 0, {10, 20, 100, 100});
+    CHECK_EQ(res.data.size(), 3u);
+    CHECK_EQ(geometry(stepOf(res, clients[0]).geometry), "10 20 100 33");
+    CHECK_EQ(geometry(stepOf(res, clients[1]).geometry), "10 53 100 33");
+    // the last client gets the remaining pixels
+    CHECK_EQ(geometry(stepOf(res, clients[2]).geometry), "10 86 100 34");
+}
+
+TEST(vertical_neighbour) {
+    CHECK_EQ(neighbour(LayoutAlgorithm::vertical, 3, 1, Direction::Down), 2);
+    CHECK_EQ(neighbour(LayoutAlgorithm::vertical, 3, 1, Direction::Up), 0);
+    CHECK_EQ(neighbour(LayoutAlgorithm::vertical, 3, 1, Direction::Left), -1);
+    CHECK_EQ(neighbour(LayoutAlgorithm::vertical, 3, 1, Direction::Right), -1);
+}
+
+TEST(horizontal_apply) {
+    auto clients = placeholderClients(3);
+    auto res = apply(LayoutAlgorithm::horizontal, clients, 0, {0, 0, 100, 50});
+    CHECK_EQ(geometry(stepOf(res, clients[0]).geometry), "0 0 33 50");
+    CHECK_EQ(geometry(stepOf(res, clients[1]).geometry), "33 0 33 50");
+    CHECK_EQ(geometry(stepOf(res, clients[2]).geometry), "66 0 34 50");
+}
+
+TEST(horizontal_neighbour) {
+    CHECK_EQ(neighbour(LayoutAlgorithm::horizontal, 3, 1, Direction::Right), 2);
+    CHECK_EQ(neighbour(LayoutAlgorithm::horizontal, 3, 1, Direction::Left), 0);
+    CHECK_EQ(neighbour(LayoutAlgorithm::horizontal, 3, 1, Direction::Up), -1);
+    CHECK_EQ(neighbour(LayoutAlgorithm::horizontal, 3, 1, Direction::Down), -1);
+}
+
+TEST(max_apply) {
+    auto clients = placeholderClients(3);
+    auto res = apply(LayoutAlgorithm::max, clients, 1, {0, 0, 100, 50});
+    CHECK_EQ(res.data.size(), 3u);
+    for (auto client : clients) {
+        CHECK_EQ(geometry(stepOf(res, client).geometry), "0 0 100 50");
+    }
+    // only the selected client is visible and raised
+    CHECK(stepOf(res, clients[1]).visible);
+    CHECK(stepOf(res, clients[1]).needsRaise);
+    CHECK(!stepOf(res, clients[0]).visible);
+    CHECK(!stepOf(res, clients[0]).needsRaise);
+    CHECK(!stepOf(res, clients[2]).visible);
+}
+
+TEST(max_apply_pseudotiled) {
+    auto clients = placeholderClients(3);
+    auto res = apply(LayoutAlgorithm::max, clients, 1, {0, 0, 100, 50},
+                     {}, ClientState(true));
+    // pseudotiled clients do not cover the clients below them
+    for (auto client : clients) {
+        CHECK(stepOf(res, client).visible);
+    }
+}
+
+TEST(max_neighbour) {
+    for (auto direction : {Direction::Up, Direction::Down,
+                           Direction::Left, Direction::Right}) {
+        CHECK_EQ(neighbour(LayoutAlgorithm::max, 3, 1, direction), -1);
+    }
+}
+
+TEST(grid_size) {
+    int rows, cols;
+    GridLayout::gridSize(5, &rows, &cols);
+    CHECK_EQ(rows, 2);
+    CHECK_EQ(cols, 3);
+    GridLayout::gridSize(9, &rows, &cols);
+    CHECK_EQ(rows, 3);
+    CHECK_EQ(cols, 3);
+}
+
+TEST(grid_apply) {
+    auto clients = placeholderClients(5);
+    LayoutOptions options;
+    options.gaplessGrid = false;
+    auto res = apply(LayoutAlgorithm::grid, clients, 0, {0, 0, 90, 60},
+                     options);
+    CHECK_EQ(geometry(stepOf(res, clients[0]).geometry), "0 0 30 30");
+    CHECK_EQ(geometry(stepOf(res, clients[2]).geometry), "60 0 30 30");
+    CHECK_EQ(geometry(stepOf(res, clients[3]).geometry), "0 30 30 30");
+    CHECK_EQ(geometry(stepOf(res, clients[4]).geometry), "30 30 30 30");
+}
+
+TEST(grid_apply_gapless) {
+    auto clients = placeholderClients(5);
+    LayoutOptions options;
+    options.gaplessGrid = true;
+    auto res = apply(LayoutAlgorithm::grid, clients, 0, {0, 0, 90, 60},
+                     options);
+    // the last client fills the remaining columns
+    CHECK_EQ(geometry(stepOf(res, clients[4]).geometry), "30 30 60 30");
+}
+
+TEST(grid_neighbour) {
+    LayoutOptions options;
+    options.gaplessGrid = false;
+    // 5 clients in 3 columns: 0 1 2 / 3 4
+    CHECK_EQ(neighbour(LayoutAlgorithm::grid, 5, 1, Direction::Down, options), 4);
+    CHECK_EQ(neighbour(LayoutAlgorithm::grid, 5, 4, Direction::Up, options), 1);
+    CHECK_EQ(neighbour(LayoutAlgorithm::grid, 5, 2, Direction::Right, options), -1);
+    CHECK_EQ(neighbour(LayoutAlgorithm::grid, 5, 3, Direction::Left, options), -1);
+    CHECK_EQ(neighbour(LayoutAlgorithm::grid, 5, 3, Direction::Right, options), 4);
+    // the caller discards indices beyond the last client
+    CHECK_EQ(neighbour(LayoutAlgorithm::grid, 5, 2, Direction::Down, options), 5);
+    options.gaplessGrid = true;
+    CHECK_EQ(neighbour(LayoutAlgorithm::grid, 5, 2, Direction::Down, options), 4);
+}
+
+TEST(master_apply) {
+    auto clients = placeholderClients(3);
+    LayoutOptions options;
+    options.masterWidthPercent = 60;
+    auto res = apply(LayoutAlgorithm::master, clients, 0, {0, 0, 100, 91},
+                     options);
+    CHECK_EQ(res.data.size(), 3u);
+    CHECK_EQ(geometry(stepOf(res, clients[0]).geometry), "0 0 60 91");
+    CHECK_EQ(geometry(stepOf(res, clients[1]).geometry), "60 0 40 45");
+    CHECK_EQ(geometry(stepOf(res, clients[2]).geometry), "60 45 40 46");
+}
+
+TEST(master_apply_single_client) {
+    auto clients = placeholderClients(1);
+    auto res = apply(LayoutAlgorithm::master, clients, 0, {5, 5, 100, 90});
+    CHECK_EQ(geometry(stepOf(res, clients[0]).geometry), "5 5 100 90");
+}
+
+TEST(master_neighbour) {
+    CHECK_EQ(neighbour(LayoutAlgorithm::master, 3, 0, Direction::Right), 1);
+    CHECK_EQ(neighbour(LayoutAlgorithm::master, 1, 0, Direction::Right), -1);
+    CHECK_EQ(neighbour(LayoutAlgorithm::master, 3, 0, Direction::Down), -1);
+    CHECK_EQ(neighbour(LayoutAlgorithm::master, 3, 2, Direction::Left), 0);
+    CHECK_EQ(neighbour(LayoutAlgorithm::master, 3, 1, Direction::Up), -1);
+    CHECK_EQ(neighbour(LayoutAlgorithm::master, 3, 2, Direction::Up), 1);
+    CHECK_EQ(neighbour(LayoutAlgorithm::master, 3, 1, Direction::Down), 2);
+    CHECK_EQ(neighbour(LayoutAlgorithm::master, 3, 2, Direction::Right), -1);
+}
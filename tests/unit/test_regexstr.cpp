@@ -0,0 +1,32 @@
+#include <set>
+#include <string>
+
+#include "regexstr.h"
+#include "unittest.h"
+
+using std::set;
+using std::string;
+
+TEST(literal_alternatives) {
+    set<string> literals;
+    CHECK(RegexStr::literalAlternatives("foo", literals));
+    CHECK_EQ(literals.size(), 1u);
+    CHECK(RegexStr::literalAlternatives("foo|bar-2", literals));
+    CHECK_EQ(literals.size(), 2u);
+    CHECK_EQ(literals.count("bar-2"), 1u);
+}
+
+TEST(literal_alternatives_special_characters) {
+    set<string> literals;
+    for (auto source : {"f.o", "foo*", "(foo)", "^foo$", "foo\\|", "[a]"}) {
+        CHECK(!RegexStr::literalAlternatives(source, literals));
+    }
+}
+
+TEST(literal_alternatives_empty) {
+    set<string> literals;
+    // empty alternatives are not allowed in extended regexes
+    for (auto source : {"", "foo|", "|foo", "foo||bar"}) {
+        CHECK(!RegexStr::literalAlternatives(source, literals));
+    }
+}
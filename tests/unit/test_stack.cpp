@@ -0,0 +1,113 @@
+#include <string>
+#include <vector>
+
+#include "recordingbackend.h"
+#include "stack.h"
+#include "unittest.h"
+
+using std::string;
+using std::vector;
+
+//! the last restack request, or "" if there was none
+static string lastRestack(const RecordingBackend& backend) {
+    for (auto it = backend.requests.rbegin(); it != backend.requests.rend(); it++) {
+        if (it->compare(0, 7, "restack") == 0) {
+            return *it;
+        }
+    }
+    return "";
+}
+
+TEST(stack_restack_only_when_dirty) {
+    RecordingBackend backend;
+    Stack stack(backend);
+    Slice* frame = Slice::makeFrameSlice(0x10);
+    stack.insertSlice(frame);
+    stack.restack();
+    CHECK_EQ(backend.requests.size(), 1u);
+    CHECK_EQ(backend.requests[0], "restack 0x10");
+    // nothing changed since, so there is no further request
+    stack.restack();
+    CHECK_EQ(backend.requests.size(), 1u);
+    stack.markDirty();
+    stack.restack();
+    CHECK_EQ(backend.requests.size(), 2u);
+    stack.removeSlice(frame);
+    delete frame;
+}
+
+TEST(stack_restacks_decoration_windows) {
+    RecordingBackend backend;
+    Stack stack(backend);
+    Slice* client = Slice::makeClientSlice(nullptr, 0x21, 0x20, false);
+    Slice* frame = Slice::makeFrameSlice(0x10);
+    stack.insertSlice(frame);
+    stack.insertSlice(client);
+    stack.restack();
+    // the client slice is stacked by its decoration window, above the frames
+    CHECK_EQ(lastRestack(backend), "restack 0x20 0x10");
+    vector<Window> clientWindows;
+    stack.extractWindows(true, [&](Window w) { clientWindows.push_back(w); });
+    CHECK_EQ(clientWindows.size(), 1u);
+    CHECK_EQ(clientWindows[0], 0x21u);
+    stack.removeSlice(client);
+    stack.removeSlice(frame);
+    delete client;
+    delete frame;
+}
+
+TEST(stack_floating_above_tiling) {
+    RecordingBackend backend;
+    Stack stack(backend);
+    Slice* floating = Slice::makeClientSlice(nullptr, 0x31, 0x30, true);
+    Slice* tiled = Slice::makeClientSlice(nullptr, 0x41, 0x40, false);
+    stack.insertSlice(floating);
+    stack.insertSlice(tiled);
+    stack.restack();
+    CHECK_EQ(lastRestack(backend), "restack 0x30 0x40");
+    stack.removeSlice(floating);
+    stack.removeSlice(tiled);
+    delete floating;
+    delete tiled;
+}
+
+TEST(stack_raise_slice) {
+    RecordingBackend backend;
+    Stack stack(backend);
+    Slice* lower = Slice::makeWindowSlice(0x1);
+    Slice* upper = Slice::makeWindowSlice(0x2);
+    stack.insertSlice(lower);
+    stack.insertSlice(upper);
+    stack.restack();
+    CHECK_EQ(lastRestack(backend), "restack 0x2 0x1");
+    // raising restacks right away
+    stack.raiseSlice(lower);
+    CHECK_EQ(lastRestack(backend), "restack 0x1 0x2");
+    stack.removeSlice(lower);
+    stack.removeSlice(upper);
+    delete lower;
+    delete upper;
+}
+
+TEST(stack_restacked_signal) {
+    RecordingBackend backend;
+    Stack stack(backend);
+    int emitted = 0;
+    stack.restacked_.connect([&emitted]() { emitted++; });
+    stack.restack();
+    CHECK_EQ(emitted, 0);
+    stack.markDirty();
+    stack.restack();
+    CHECK_EQ(emitted, 1);
+}
+
+TEST(recording_backend_window_class) {
+    RecordingBackend backend;
+    backend.windowClasses[0x5] = {"xterm", "XTerm"};
+    auto hint = backend.windowClass(0x5);
+    CHECK_EQ(hint.first, "xterm");
+    CHECK_EQ(hint.second, "XTerm");
+    CHECK_EQ(backend.windowClass(0x6).second, "");
+    CHECK_EQ(backend.requests.size(), 2u);
+    CHECK_EQ(backend.requests[0], "class 0x5");
+}
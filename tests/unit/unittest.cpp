@@ -0,0 +1,51 @@
+#include "unittest.h"
+
+#include <iostream>
+#include <vector>
+
+using std::endl;
+using std::string;
+using std::vector;
+
+struct RegisteredTest {
+    const char* name;
+    UnitTest::Function function;
+};
+
+// a function-local static, because the registrations are static objects
+// in other translation units
+static vector<RegisteredTest>& registeredTests() {
+    static vector<RegisteredTest> tests;
+    return tests;
+}
+
+static bool g_current_test_failed = false;
+
+UnitTest::UnitTest(const char* name, Function function) {
+    registeredTests().push_back({name, function});
+}
+
+void UnitTest::fail(const char* file, int line, const string& message) {
+    std::cerr << file << ":" << line << ": " << message << endl;
+    g_current_test_failed = true;
+}
+
+int UnitTest::runAll() {
+    int failed = 0;
+    for (const auto& test : registeredTests()) {
+        g_current_test_failed = false;
+        test.function();
+        std::cout << (g_current_test_failed ? "FAIL " : "ok   ")
+                  << test.name << endl;
+        if (g_current_test_failed) {
+            failed++;
+        }
+    }
+    std::cout << registeredTests().size() << " tests, "
+              << failed << " failed" << endl;
+    return failed;
+}
+
+int main() {
+    return UnitTest::runAll() == 0 ? 0 : 1;
+}
@@ -0,0 +1,46 @@
+#ifndef HERBSTLUFT_UNITTEST_H
+#define HERBSTLUFT_UNITTEST_H
+
+#include <sstream>
+#include <string>
+
+/*! A minimal unit test registry for the X-independent core of
+ * herbstluftwm. Every TEST() registers itself, and the test runner
+ * executes all of them and reports the failed checks.
+ */
+class UnitTest {
+public:
+    using Function = void (*)();
+    UnitTest(const char* name, Function function);
+
+    //! run all registered tests and return the number of failed ones
+    static int runAll();
+    //! record a failed check in the currently running test
+    static void fail(const char* file, int line, const std::string& message);
+};
+
+#define TEST(name) \
+    static void name(); \
+    static UnitTest name##_registration(#name, name); \
+    static void name()
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            UnitTest::fail(__FILE__, __LINE__, #condition); \
+        } \
+    } while (0)
+
+#define CHECK_EQ(actual, expected) \
+    do { \
+        auto actual_ = (actual); \
+        auto expected_ = (expected); \
+        if (!(actual_ == expected_)) { \
+            std::ostringstream message_; \
+            message_ << #actual << " is " << actual_ \
+                     << " but expected " << expected_; \
+            UnitTest::fail(__FILE__, __LINE__, message_.str()); \
+        } \
+    } while (0)
+
+#endif